@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#pragma once
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+#ifndef MARSHMALLOW_CORE_ATOMIC_H
+#define MARSHMALLOW_CORE_ATOMIC_H 1
+
+#include <core/environment.h>
+#include <core/namespace.h>
+
+#if defined(_MSC_VER)
+#   include <intrin.h>
+#endif
+
+MARSHMALLOW_NAMESPACE_BEGIN
+namespace Core { /******************************************** Core Namespace */
+namespace Atomic { /********************************** Core::Atomic Namespace */
+	/*
+	 * A collection of lock-free atomic operations, all of them imply a
+	 * full memory barrier except for Load() which only acquires.
+	 */
+
+	/*!
+	 * @brief Full memory barrier
+	 */
+	inline void
+	Barrier(void)
+	{
+#if defined(_MSC_VER)
+		long l_fence = 0;
+		_InterlockedOr(&l_fence, 0);
+#else
+		__sync_synchronize();
+#endif
+	}
+
+	/*!
+	 * @brief Busy-wait hint
+	 *
+	 * Eases off the pipeline (and a sibling hyper-thread) while
+	 * spinning, it's not a memory barrier.
+	 */
+	inline void
+	Pause(void)
+	{
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+		_mm_pause();
+#elif defined(__i386__) || defined(__x86_64__)
+		__builtin_ia32_pause();
+#elif defined(__aarch64__) || (defined(__ARM_ARCH) && __ARM_ARCH >= 7)
+		__asm__ __volatile__("yield");
+#endif
+	}
+
+	/*!
+	 * @brief Atomically adds delta to value
+	 * @return Resulting value
+	 */
+	inline int32_t
+	Add(volatile int32_t *value, int32_t delta)
+	{
+#if defined(_MSC_VER)
+		return(_InterlockedExchangeAdd
+		    (reinterpret_cast<volatile long *>(value), delta) + delta);
+#else
+		return(__sync_add_and_fetch(value, delta));
+#endif
+	}
+
+	inline int32_t
+	Increment(volatile int32_t *value)
+	    { return(Add(value, 1)); }
+
+	inline int32_t
+	Decrement(volatile int32_t *value)
+	    { return(Add(value, -1)); }
+
+	/*!
+	 * @brief Atomic read of value (acquire)
+	 *
+	 * Later reads and writes can't be moved ahead of it.
+	 */
+	inline int32_t
+	Load(const volatile int32_t *value)
+	{
+#if defined(_MSC_VER)
+		return(_InterlockedCompareExchange
+		    (reinterpret_cast<volatile long *>
+		        (const_cast<volatile int32_t *>(value)), 0, 0));
+#elif defined(__ATOMIC_ACQUIRE)
+		return(__atomic_load_n(value, __ATOMIC_ACQUIRE));
+#else
+		const int32_t l_value = *value;
+		__sync_synchronize();
+		return(l_value);
+#endif
+	}
+
+	/*!
+	 * @brief Replaces value with desired only if it still equals expected
+	 * @return true if the swap took place
+	 */
+	inline bool
+	CompareAndSwap(volatile int32_t *value, int32_t expected, int32_t desired)
+	{
+#if defined(_MSC_VER)
+		return(expected == _InterlockedCompareExchange
+		    (reinterpret_cast<volatile long *>(value), desired, expected));
+#else
+		return(__sync_bool_compare_and_swap(value, expected, desired));
+#endif
+	}
+
+	/*!
+	 * @brief Replaces pointer with desired only if it still equals expected
+	 * @return true if the swap took place
+	 */
+	template <typename T>
+	inline bool
+	CompareAndSwap(T * volatile *pointer, T *expected, T *desired)
+	{
+#if defined(_MSC_VER)
+		return(expected == _InterlockedCompareExchangePointer
+		    (reinterpret_cast<void * volatile *>(pointer),
+		     desired, expected));
+#else
+		return(__sync_bool_compare_and_swap(pointer, expected, desired));
+#endif
+	}
+
+	/*!
+	 * @brief Replaces pointer with value
+	 * @return Previous pointer value
+	 */
+	template <typename T>
+	inline T *
+	Exchange(T * volatile *pointer, T *value)
+	{
+#if defined(_MSC_VER)
+		return(static_cast<T *>(_InterlockedExchangePointer
+		    (reinterpret_cast<void * volatile *>(pointer), value)));
+#else
+		T *l_old;
+		do l_old = *pointer;
+		while (!__sync_bool_compare_and_swap(pointer, l_old, value));
+		return(l_old);
+#endif
+	}
+
+} /*************************************************** Core::Atomic Namespace */
+} /*********************************************************** Core Namespace */
+MARSHMALLOW_NAMESPACE_END
+
+#endif
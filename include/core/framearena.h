@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#pragma once
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+#ifndef MARSHMALLOW_CORE_FRAMEARENA_H
+#define MARSHMALLOW_CORE_FRAMEARENA_H 1
+
+#include <core/environment.h>
+#include <core/global.h>
+#include <core/namespace.h>
+
+#include <cstddef>
+#include <new>
+
+MARSHMALLOW_NAMESPACE_BEGIN
+namespace Core { /******************************************** Core Namespace */
+
+	/*!
+	 * @brief Frame Scratch Arena
+	 *
+	 * Linear (bump) allocator for short-lived allocations, memory is
+	 * never freed individually, everything is released at once by
+	 * reset(). When a frame overflows the current block a new one is
+	 * chained, on reset blocks get merged so the next frame fits in one.
+	 *
+	 * Not thread safe, the instance arena belongs to the engine thread
+	 * and gets reset at the end of every engine loop iteration.
+	 */
+	class MARSHMALLOW_CORE_EXPORT
+	FrameArena
+	{
+		PRIVATE_IMPLEMENTATION
+		NO_ASSIGN_COPY(FrameArena);
+	public:
+
+		/*!
+		 * @param size Initial block size in bytes
+		 */
+		FrameArena(size_t size = 64 * 1024);
+		~FrameArena(void);
+
+		/*!
+		 * @brief Allocate size bytes
+		 * @param align Power of two alignment
+		 */
+		void * allocate(size_t size, size_t align = 2 * sizeof(void *));
+
+		/*! @brief Release every allocation */
+		void reset(void);
+
+		/*! @brief Bytes allocated since last reset */
+		size_t used(void) const;
+
+		/*! @brief Bytes reserved in blocks */
+		size_t capacity(void) const;
+
+		/*! @brief Highest used() seen */
+		size_t peak(void) const;
+
+	public: /* static */
+
+		/*! @brief Engine thread arena */
+		static FrameArena & Instance(void);
+	};
+
+	/*!
+	 * @brief STL allocator adaptor for FrameArena
+	 *
+	 * deallocate() is a no-op, containers using it must not outlive the
+	 * arena reset.
+	 */
+	template <typename T>
+	class FrameAllocator
+	{
+		template <typename U> friend class FrameAllocator;
+		FrameArena *m_arena;
+	public:
+		typedef T              value_type;
+		typedef T *            pointer;
+		typedef const T *      const_pointer;
+		typedef T &            reference;
+		typedef const T &      const_reference;
+		typedef size_t         size_type;
+		typedef ptrdiff_t      difference_type;
+
+		template <typename U>
+		struct rebind { typedef FrameAllocator<U> other; };
+
+		FrameAllocator(void)
+		    : m_arena(&FrameArena::Instance()) {}
+
+		FrameAllocator(FrameArena &arena)
+		    : m_arena(&arena) {}
+
+		template <typename U>
+		FrameAllocator(const FrameAllocator<U> &other)
+		    : m_arena(other.m_arena) {}
+
+		pointer address(reference x) const
+		    { return(&x); }
+
+		const_pointer address(const_reference x) const
+		    { return(&x); }
+
+		pointer allocate(size_type n, const void * = 0)
+		    { return(static_cast<pointer>
+		          (m_arena->allocate(n * sizeof(T)))); }
+
+		void deallocate(pointer, size_type)
+		    {}
+
+		size_type max_size(void) const
+		    { return(size_type(-1) / sizeof(T)); }
+
+		void construct(pointer p, const T &value)
+		    { new(static_cast<void *>(p)) T(value); }
+
+		void destroy(pointer p)
+		    { p->~T(); }
+
+		template <typename U>
+		bool operator==(const FrameAllocator<U> &other) const
+		    { return(m_arena == other.m_arena); }
+
+		template <typename U>
+		bool operator!=(const FrameAllocator<U> &other) const
+		    { return(m_arena != other.m_arena); }
+	};
+
+} /*********************************************************** Core Namespace */
+MARSHMALLOW_NAMESPACE_END
+
+#endif
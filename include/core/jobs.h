@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#pragma once
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+#ifndef MARSHMALLOW_CORE_JOBS_H
+#define MARSHMALLOW_CORE_JOBS_H 1
+
+#include <core/environment.h>
+#include <core/namespace.h>
+
+MARSHMALLOW_NAMESPACE_BEGIN
+
+namespace Core { /******************************************** Core Namespace */
+
+namespace Jobs { /************************************** Core::Jobs Namespace */
+	/*
+	 * Work-stealing job scheduler
+	 *
+	 * Every worker thread owns a deque, jobs submitted from a worker go
+	 * into its own deque and get picked up newest first, idle workers
+	 * steal the oldest jobs from the others. Threads waiting on a counter
+	 * run pending jobs meanwhile, they only block once there is nothing
+	 * left to help with and the counter is still busy.
+	 *
+	 * Without worker threads (not initialized, or a single core system)
+	 * jobs run immediately on the submitting thread.
+	 */
+
+	typedef void (*Function)(void *data);
+	typedef void (*RangeFunction)(void *data, size_t begin, size_t end);
+
+	/*!
+	 * @brief Job completion counter
+	 *
+	 * Incremented for every job submitted against it and decremented as
+	 * each one finishes, zero means all of them are done.
+	 */
+	struct MARSHMALLOW_CORE_EXPORT
+	Counter
+	{
+		Counter(void)
+		    : pending(0) {}
+
+		bool isDone(void) const;
+
+		mutable volatile int32_t pending;
+	};
+
+	/*!
+	 * @brief Start worker threads
+	 *
+	 * @param workers Worker count, zero picks one less than the
+	 *                hardware thread count.
+	 */
+	MARSHMALLOW_CORE_EXPORT
+	void Initialize(unsigned int workers = 0);
+
+	/*!
+	 * @brief Stop worker threads, pending jobs are run first
+	 */
+	MARSHMALLOW_CORE_EXPORT
+	void Finalize(void);
+
+	/*!
+	 * @brief Number of worker threads running
+	 */
+	MARSHMALLOW_CORE_EXPORT
+	unsigned int Workers(void);
+
+	/*!
+	 * @brief Submit job
+	 *
+	 * @param function Job procedure
+	 * @param data User data passed to procedure
+	 * @param counter Counter to track completion with (optional)
+	 * @param dependency Job won't start until this counter is done
+	 *                   (optional)
+	 */
+	MARSHMALLOW_CORE_EXPORT
+	void Run(Function function, void *data, Counter *counter = 0,
+	    Counter *dependency = 0);
+
+	/*!
+	 * @brief Split range in jobs
+	 *
+	 * The [begin, end) range is split in chunks of grain elements, each
+	 * one handled by a separate job. If no counter is given the call
+	 * waits for every chunk to finish.
+	 *
+	 * @param grain Chunk size, zero picks one based on worker count
+	 */
+	MARSHMALLOW_CORE_EXPORT
+	void ParallelFor(RangeFunction function, void *data,
+	    size_t begin, size_t end, size_t grain = 0, Counter *counter = 0);
+
+	/*!
+	 * @brief Wait for counter, running pending jobs in the meantime
+	 *
+	 * Spins briefly once there is nothing to run, then blocks until
+	 * another job finishes or gets submitted.
+	 */
+	MARSHMALLOW_CORE_EXPORT
+	void Wait(const Counter &counter);
+
+} /***************************************************** Core::Jobs Namespace */
+
+} /*********************************************************** Core Namespace */
+MARSHMALLOW_NAMESPACE_END
+
+#endif
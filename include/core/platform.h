@@ -95,6 +95,64 @@ namespace Platform { /****************************** Core::Platform Namespace */
 	MARSHMALLOW_CORE_EXPORT
 	TimeData TimeStampToTimeData(MMTIME timestamp);
 
+	/***************************************************** events */
+
+	/*!
+	 * Add a file descriptor to the set WaitEvents() blocks on
+	 *
+	 * @param fd Descriptor that becomes readable when there is input
+	 */
+	MARSHMALLOW_CORE_EXPORT
+	void WatchDescriptor(int fd);
+
+	/*!
+	 * Remove a file descriptor added with WatchDescriptor()
+	 */
+	MARSHMALLOW_CORE_EXPORT
+	void UnwatchDescriptor(int fd);
+
+	/*!
+	 * Returns true if input is already buffered in user space, where
+	 * polling its descriptor can't see it
+	 */
+	typedef bool (*PendingFunction)(void);
+
+	/*!
+	 * Consult pending before WaitEvents() blocks
+	 */
+	MARSHMALLOW_CORE_EXPORT
+	void WatchPending(PendingFunction pending);
+
+	/*!
+	 * Remove a function added with WatchPending()
+	 */
+	MARSHMALLOW_CORE_EXPORT
+	void UnwatchPending(PendingFunction pending);
+
+	/*!
+	 * Block until there is input, Wake() gets called or timeout expires
+	 *
+	 * @param timeout Timeout in seconds
+	 * @return False if the platform has nothing to wait on, callers
+	 *         should fall back to sleeping
+	 */
+	MARSHMALLOW_CORE_EXPORT
+	bool WaitEvents(MMTIME timeout);
+
+	/*!
+	 * Interrupt WaitEvents(), safe to call from any thread
+	 */
+	MARSHMALLOW_CORE_EXPORT
+	void Wake(void);
+
+	/***************************************************** memory */
+
+	/*!
+	 * Returns the process resident memory in bytes, zero if unknown
+	 */
+	MARSHMALLOW_CORE_EXPORT
+	size_t MemoryUsage(void);
+
 	/*************************************************** location */
 
 	MARSHMALLOW_CORE_EXPORT
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#pragma once
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+#ifndef MARSHMALLOW_CORE_THREAD_H
+#define MARSHMALLOW_CORE_THREAD_H 1
+
+#include <core/environment.h>
+#include <core/global.h>
+#include <core/namespace.h>
+
+MARSHMALLOW_NAMESPACE_BEGIN
+namespace Core { /******************************************** Core Namespace */
+
+	/*!
+	 * @brief Native thread of execution
+	 *
+	 * Thin wrapper around the platform threading API, the procedure
+	 * will be called from the new thread with the supplied data.
+	 */
+	class MARSHMALLOW_CORE_EXPORT
+	Thread
+	{
+		PRIVATE_IMPLEMENTATION
+		NO_ASSIGN_COPY(Thread);
+	public:
+
+		typedef void (*Procedure)(void *data);
+
+		/*!
+		 * @param procedure Procedure to run in thread
+		 * @param data User data passed to procedure
+		 */
+		Thread(Procedure procedure, void *data = 0);
+
+		/*!
+		 * Destroying a running thread will block until it finishes.
+		 */
+		~Thread(void);
+
+		/*!
+		 * @brief Start thread
+		 * @return false if thread failed to start or is already running
+		 */
+		bool start(void);
+
+		/*!
+		 * @brief Block until thread procedure returns
+		 */
+		bool join(void);
+
+		bool isRunning(void) const;
+
+	public: /* static */
+
+		/*!
+		 * @brief Number of hardware threads available, at least 1.
+		 */
+		static unsigned int HardwareConcurrency(void);
+
+		/*!
+		 * @brief Give up the rest of the calling thread's time slice
+		 */
+		static void Relinquish(void);
+	};
+
+} /*********************************************************** Core Namespace */
+MARSHMALLOW_NAMESPACE_END
+
+#endif
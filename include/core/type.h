@@ -57,8 +57,21 @@ namespace Core { /******************************************** Core Namespace */
 
 		virtual ~Type(void);
 
+		/*!
+		 * @brief Small integer id, unique per type string
+		 *
+		 * Assigned on first use, ids are dense in that order which
+		 * makes them suitable for indexing per-type tables.
+		 */
+		int index(void) const
+		    { return(m_index >= 0 ? m_index : assignIndex()); }
+
 	public:
 		static const Type Null;
+
+	private:
+		int assignIndex(void) const;
+		mutable volatile int32_t m_index;
 	};
 
 } /*********************************************************** Core Namespace */
@@ -48,11 +48,14 @@
 MARSHMALLOW_NAMESPACE_BEGIN
 namespace Event { /****************************************** Event Namespace */
 
-	/*! @brief Event Base Class */
+	/*! @brief Event Base Class
+	 *
+	 *  Timestamp and priority are stored inline (no private
+	 *  implementation), events are short lived and allocated in bulk.
+	 */
 	class MARSHMALLOW_EVENT_EXPORT
 	Event : public IEvent
 	{
-		PRIVATE_IMPLEMENTATION
 		NO_ASSIGN_COPY(Event);
 	public:
 
@@ -67,6 +70,11 @@ namespace Event { /****************************************** Event Namespace */
 		Event(MMTIME timestamp = 0, uint8_t priority = 0);
 		virtual ~Event(void);
 
+	private:
+
+		MMTIME m_timestamp;
+		uint8_t m_priority;
+
 	public: /* virtual */
 
 		VIRTUAL uint8_t priority(void) const;
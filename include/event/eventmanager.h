@@ -44,11 +44,13 @@
 #include <core/environment.h>
 #include <core/global.h>
 #include <core/namespace.h>
+#include <core/type.h>
+
+#include <new>
 
 MARSHMALLOW_NAMESPACE_BEGIN
 namespace Core { /******************************************** Core Namespace */
 	class Identifier;
-	class Type;
 } /*********************************************************** Core Namespace */
 
 namespace Event { /****************************************** Event Namespace */
@@ -64,21 +66,335 @@ namespace Event { /****************************************** Event Namespace */
 		NO_ASSIGN_COPY(EventManager);
 	public:
 
-		EventManager(const Core::Identifier &identifier);
+		/*! @brief Event Queue Mode */
+		enum QueueMode
+		{
+			SerialQueue = 0,  /*!< queue() only from the execute() thread */
+			ConcurrentQueue   /*!< queue() from any thread (lock-free) */
+		};
+
+		/*!
+		 * @brief Event Callback
+		 *
+		 * Receives the binding data given to connect() and the event
+		 * being dispatched, returns true if the event was handled.
+		 */
+		typedef bool (*EventCallback)(const void *binding,
+		                              const IEvent &event);
+
+		/*! @brief Maximum binding data size (in bytes) */
+		enum { BindingSize = 32 };
+
+		/*!
+		 * @brief Event Coalescer
+		 *
+		 * Computes the coalescing key of an event, returns false if
+		 * the event must not be coalesced.
+		 */
+		typedef bool (*Coalescer)(const IEvent &event, uint32_t &key);
+
+		/*!
+		 * @brief Subscription Key Function
+		 *
+		 * Computes the subscription key of an event (key code, button,
+		 * device...), returns false if the event has none.
+		 */
+		typedef bool (*KeyFunction)(const IEvent &event, uint32_t &key);
+
+		/*! @brief Per Event Type Statistics */
+		struct TypeStats
+		{
+			Core::Type type;
+			uint32_t queued;
+			uint32_t coalesced;   /*!< replaced by a newer event */
+			uint32_t dispatched;
+			uint32_t handled;
+			MMTIME latency;       /*!< total timestamp to dispatch */
+			MMTIME latency_max;
+		};
+
+		/*! @brief Per Listener Statistics */
+		struct ListenerStats
+		{
+			const void *listener; /*!< listener or bound object */
+			Core::Type type;
+			uint32_t calls;
+			MMTIME time;          /*!< total time spent in listener */
+			MMTIME time_max;
+		};
+
+		/*!
+		 * @brief Event Manager Statistics
+		 *
+		 * Arrays are owned by the event manager and stay valid until
+		 * the next call to a non-const member.
+		 */
+		struct Stats
+		{
+			const TypeStats *types;
+			size_t type_count;
+			const ListenerStats *listeners;
+			size_t listener_count;
+			size_t queue_depth;   /*!< events currently pending */
+			size_t backlog;       /*!< events left over by budget */
+			size_t queue_peak;    /*!< pending queue high-watermark */
+			size_t schedule_peak; /*!< schedule high-watermark */
+		};
+
+	private:
+
+		template <typename T, typename C>
+		struct MemberBinding
+		{
+			C *object;
+			bool (C::*method)(const T &);
+
+			static bool
+			Invoke(const void *binding, const IEvent &event)
+			{
+				const MemberBinding *l_binding =
+				    static_cast<const MemberBinding *>(binding);
+				return((l_binding->object->*l_binding->method)
+				    (static_cast<const T &>(event)));
+			}
+		};
+
+	public:
+
+		EventManager(const Core::Identifier &identifier,
+		             QueueMode mode = SerialQueue);
 		~EventManager(void);
 
 		const Core::Identifier & id(void) const;
 
+		QueueMode queueMode(void) const;
+
 		bool connect(IEventListener *handler, const Core::Type &type);
 		bool disconnect(IEventListener *handler, const Core::Type &type);
 
+		/*!
+		 * @brief Connect a callback to an event type
+		 *
+		 * Binding data is copied (up to BindingSize bytes) and passed
+		 * back to the callback, a callback/binding pair is identified
+		 * by its contents.
+		 */
+		bool connect(const Core::Type &type, EventCallback callback,
+		             const void *binding, size_t size);
+		bool disconnect(const Core::Type &type, EventCallback callback,
+		                const void *binding, size_t size);
+
+		/*!
+		 * @brief Connect a listener to events of type with a key
+		 *
+		 * Keyed listeners only see events whose subscription key (as
+		 * computed by the type's key function) matches, they are
+		 * visited before the listeners connected without a key.
+		 */
+		bool connect(IEventListener *handler, const Core::Type &type,
+		             uint32_t key);
+		bool disconnect(IEventListener *handler, const Core::Type &type,
+		                uint32_t key);
+
+		bool connect(const Core::Type &type, EventCallback callback,
+		             const void *binding, size_t size, uint32_t key);
+		bool disconnect(const Core::Type &type, EventCallback callback,
+		                const void *binding, size_t size, uint32_t key);
+
+		/*!
+		 * @brief Set subscription key function for an event type
+		 *
+		 * Required before connecting keyed listeners to the type.
+		 */
+		bool setKeyFunction(const Core::Type &type, KeyFunction keyer);
+
+		/*!
+		 * @brief Connect a member function to event type T
+		 *
+		 * Events of type T are routed straight to the member function
+		 * (no IEventListener::handleEvent() call, no type checks in
+		 * the handler), T::Type() is only resolved while connecting.
+		 */
+		template <typename T, typename C>
+		bool connect(C *object, bool (C::*method)(const T &))
+		{
+			const MemberBinding<T, C> l_binding = { object, method };
+			typedef char BindingFits
+			    [sizeof(l_binding) <= BindingSize ? 1 : -1];
+			(void) sizeof(BindingFits);
+			return(connect(T::Type(), &MemberBinding<T, C>::Invoke,
+			    &l_binding, sizeof(l_binding)));
+		}
+
+		template <typename T, typename C>
+		bool disconnect(C *object, bool (C::*method)(const T &))
+		{
+			const MemberBinding<T, C> l_binding = { object, method };
+			return(disconnect(T::Type(), &MemberBinding<T, C>::Invoke,
+			    &l_binding, sizeof(l_binding)));
+		}
+
+		template <typename T, typename C>
+		bool connect(C *object, bool (C::*method)(const T &),
+		             uint32_t key)
+		{
+			const MemberBinding<T, C> l_binding = { object, method };
+			typedef char BindingFits
+			    [sizeof(l_binding) <= BindingSize ? 1 : -1];
+			(void) sizeof(BindingFits);
+			return(connect(T::Type(), &MemberBinding<T, C>::Invoke,
+			    &l_binding, sizeof(l_binding), key));
+		}
+
+		template <typename T, typename C>
+		bool disconnect(C *object, bool (C::*method)(const T &),
+		                uint32_t key)
+		{
+			const MemberBinding<T, C> l_binding = { object, method };
+			return(disconnect(T::Type(), &MemberBinding<T, C>::Invoke,
+			    &l_binding, sizeof(l_binding), key));
+		}
+
+		/*!
+		 * @brief Queue event for execution
+		 *
+		 * Events timestamped in the future are held back until they
+		 * are due, the event manager takes ownership of the event.
+		 */
 		bool queue(const IEvent *event);
+
+		/*!
+		 * @brief Remove pending, backlogged or scheduled event(s)
+		 *
+		 * @param event Event to remove
+		 * @param all Remove every event of the same type instead
+		 * @return true if any event was removed
+		 */
 		bool dequeue(const IEvent *event, bool all = false);
 
+		/*!
+		 * @brief Set coalescing policy for an event type
+		 *
+		 * A queued event replaces the pending event of the same type
+		 * and coalescing key, so only the latest one gets dispatched.
+		 * It is queued at its own position, never ahead of events
+		 * queued before it. Use a null coalescer to remove the policy.
+		 */
+		bool setCoalescer(const Core::Type &type, Coalescer coalescer);
+
 		bool dispatch(const IEvent &event);
 
+		/*!
+		 * @brief Execute queued events
+		 *
+		 * @return false if the budget ran out before the active queue
+		 *         was drained (see backlog())
+		 */
 		bool execute(void);
 
+		/*!
+		 * @brief Limit the work done by a single execute() call
+		 *
+		 * Events left over once the time (in seconds) or event count
+		 * budget is used up are carried over to the next execute(),
+		 * before any newly queued event. Use 0 for no limit.
+		 */
+		void setBudget(MMTIME time, size_t count = 0);
+		MMTIME budgetTime(void) const;
+		size_t budgetCount(void) const;
+
+		/*! @brief Events carried over by the last execute() */
+		size_t backlog(void) const;
+
+		/*!
+		 * @brief Enable statistics collection
+		 *
+		 * Disabled by default, listener timing adds two clock reads
+		 * per listener call.
+		 */
+		void setStatsEnabled(bool enabled);
+		bool isStatsEnabled(void) const;
+
+		/*! @brief Collected statistics */
+		Stats stats(void) const;
+
+		/*! @brief Zero all counters and watermarks */
+		void resetStats(void);
+
+		/*!
+		 * @brief Set event recorder
+		 *
+		 * The recorder gets every dispatched event before any
+		 * listener does, whether it ends up handled or not. There is
+		 * a single recorder slot, use 0 to clear it.
+		 *
+		 * @param recorder Recording listener, not owned
+		 */
+		void setRecorder(IEventListener *recorder);
+		IEventListener * recorder(void) const;
+
+		/*!
+		 * @brief Set event filter
+		 *
+		 * The filter sees every event before it gets queued or
+		 * dispatched, events it handles are dropped. There is a
+		 * single filter slot, use 0 to clear it.
+		 *
+		 * @param filter Filtering listener, not owned
+		 */
+		void setFilter(IEventListener *filter);
+		IEventListener * filter(void) const;
+
+		/*!
+		 * @brief Allocate event storage from the event arena
+		 *
+		 * Storage is carved out of a per-frame arena that gets
+		 * recycled in bulk once the queue it was allocated for has
+		 * been executed, only events passed to queue() should live
+		 * there. Must be called from the execute() thread.
+		 */
+		void * allocate(size_t size);
+
+		/*!
+		 * @brief Construct an event in the event arena
+		 *
+		 * Events created by make() are owned by the event manager
+		 * and must be queued, never deleted. They only live for a
+		 * frame, so future timestamps are rejected by queue().
+		 */
+		template <typename T>
+		T * make(void)
+		    { return(new (allocate(sizeof(T))) T); }
+
+		template <typename T, typename A1>
+		T * make(const A1 &a1)
+		    { return(new (allocate(sizeof(T))) T(a1)); }
+
+		template <typename T, typename A1, typename A2>
+		T * make(const A1 &a1, const A2 &a2)
+		    { return(new (allocate(sizeof(T))) T(a1, a2)); }
+
+		template <typename T, typename A1, typename A2, typename A3>
+		T * make(const A1 &a1, const A2 &a2, const A3 &a3)
+		    { return(new (allocate(sizeof(T))) T(a1, a2, a3)); }
+
+		template <typename T, typename A1, typename A2, typename A3,
+		          typename A4>
+		T * make(const A1 &a1, const A2 &a2, const A3 &a3, const A4 &a4)
+		    { return(new (allocate(sizeof(T))) T(a1, a2, a3, a4)); }
+
+		template <typename T, typename A1, typename A2, typename A3,
+		          typename A4, typename A5>
+		T * make(const A1 &a1, const A2 &a2, const A3 &a3, const A4 &a4,
+		         const A5 &a5)
+		    { return(new (allocate(sizeof(T))) T(a1, a2, a3, a4, a5)); }
+
+		template <typename T, typename A1, typename A2, typename A3,
+		          typename A4, typename A5, typename A6>
+		T * make(const A1 &a1, const A2 &a2, const A3 &a3, const A4 &a4,
+		         const A5 &a5, const A6 &a6)
+		    { return(new (allocate(sizeof(T))) T(a1, a2, a3, a4, a5, a6)); }
+
 	public: /* static */
 
 		static EventManager *Instance(void);
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#pragma once
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+#ifndef MARSHMALLOW_EVENT_EVENTPLAYER_H
+#define MARSHMALLOW_EVENT_EVENTPLAYER_H 1
+
+#include <core/environment.h>
+#include <core/global.h>
+#include <core/namespace.h>
+
+MARSHMALLOW_NAMESPACE_BEGIN
+namespace Core { /******************************************** Core Namespace */
+	struct IDataIO;
+} /*********************************************************** Core Namespace */
+
+namespace Event { /****************************************** Event Namespace */
+
+	class EventManager;
+	class InputEvent;
+
+	/*!
+	 * @brief Event Replay Driver
+	 *
+	 * Feeds an EventRecorder recording back into an event manager.
+	 * Playback follows the recorded simulation steps (the step count
+	 * passed to setStep() by the engine) instead of wall clock time,
+	 * every event gets dispatched ahead of the same step it preceded
+	 * while recording. With a fixed simulation step a session replays
+	 * the same way at any frame rate.
+	 *
+	 * Live input events are filtered out of the event manager until
+	 * playback is finished.
+	 */
+	class MARSHMALLOW_EVENT_EXPORT
+	EventPlayer
+	{
+		PRIVATE_IMPLEMENTATION
+		NO_ASSIGN_COPY(EventPlayer);
+	public:
+
+		/*!
+		 * Recording is loaded up front.
+		 *
+		 * @param input Open (readable) data device, not owned
+		 * @param manager Event manager to feed, defaults to the
+		 *                global instance
+		 */
+		EventPlayer(Core::IDataIO *input, EventManager *manager = 0);
+		virtual ~EventPlayer(void);
+
+		/*! @brief Recording loaded successfully */
+		bool isValid(void) const;
+
+		/*! @brief Every recorded event has been queued */
+		bool isFinished(void) const;
+
+		/*!
+		 * @brief Advance playback
+		 *
+		 * Dispatches every event recorded up to (and including) step,
+		 * call right before the simulation step after it is taken.
+		 */
+		void setStep(uint32_t step);
+
+		/*! @brief Current playback step */
+		uint32_t step(void) const;
+
+		/*! @brief Number of recorded events */
+		size_t count(void) const;
+
+	protected: /* virtual */
+
+		/*!
+		 * @brief Apply replayed input to the input state
+		 *
+		 * Called right before each replayed event is dispatched, the
+		 * same way live input producers update the input state before
+		 * queueing their events. Input state lives above the event
+		 * library, the engine reimplements this to update it.
+		 */
+		virtual void apply(const InputEvent &event);
+	};
+
+} /********************************************************** Event Namespace */
+MARSHMALLOW_NAMESPACE_END
+
+#endif
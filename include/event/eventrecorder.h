@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#pragma once
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+#ifndef MARSHMALLOW_EVENT_EVENTRECORDER_H
+#define MARSHMALLOW_EVENT_EVENTRECORDER_H 1
+
+#include <core/global.h>
+
+#include <event/ieventlistener.h>
+
+MARSHMALLOW_NAMESPACE_BEGIN
+namespace Core { /******************************************** Core Namespace */
+	struct IDataIO;
+} /*********************************************************** Core Namespace */
+
+namespace Event { /****************************************** Event Namespace */
+
+	class EventManager;
+
+	/*!
+	 * @brief Binary Event Recorder
+	 *
+	 * Records dispatched input events (keyboard, joystick, touch and
+	 * sensor) as fixed-size binary records, tagged with the step set
+	 * through setStep() (the engine passes its step count). The
+	 * recorder installs itself as the event manager recorder, so events
+	 * are recorded even if a listener handles them. Records are buffered
+	 * and written in batches, recordings can be played back with
+	 * EventPlayer.
+	 */
+	class MARSHMALLOW_EVENT_EXPORT
+	EventRecorder : public IEventListener
+	{
+		PRIVATE_IMPLEMENTATION
+		NO_ASSIGN_COPY(EventRecorder);
+	public:
+
+		/*!
+		 * @param output Open (writable) data device, not owned
+		 * @param manager Event manager to record, defaults to the
+		 *                global instance
+		 */
+		EventRecorder(Core::IDataIO *output, EventManager *manager = 0);
+		virtual ~EventRecorder(void);
+
+		/*! @brief Number of events recorded */
+		size_t count(void) const;
+
+		/*! @brief Simulation step following events are tagged with */
+		void setStep(uint32_t step);
+		uint32_t step(void) const;
+
+		/*! @brief Write buffered records to output */
+		bool flush(void);
+
+	public: /* virtual */
+
+		VIRTUAL bool handleEvent(const IEvent &event);
+	};
+
+} /********************************************************** Event Namespace */
+MARSHMALLOW_NAMESPACE_END
+
+#endif
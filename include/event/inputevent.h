@@ -50,7 +50,6 @@ namespace Event { /****************************************** Event Namespace */
 	class MARSHMALLOW_EVENT_EXPORT
 	InputEvent : public Event
 	{
-		PRIVATE_IMPLEMENTATION
 		NO_ASSIGN_COPY(InputEvent);
 	public:
 
@@ -79,6 +78,13 @@ namespace Event { /****************************************** Event Namespace */
 
 		size_t source(void) const;
 
+	private:
+
+		InputType m_type;
+		int m_code;
+		int m_value;
+		size_t m_source;
+
 	public: /* virtual */
 
 		VIRTUAL const Core::Type & type(void) const
@@ -52,7 +52,6 @@ namespace Event { /****************************************** Event Namespace */
 	class MARSHMALLOW_EVENT_EXPORT
 	JoystickAxisEvent : public InputEvent
 	{
-		PRIVATE_IMPLEMENTATION
 		NO_ASSIGN_COPY(JoystickAxisEvent);
 	public:
 
@@ -71,6 +70,11 @@ namespace Event { /****************************************** Event Namespace */
 
 		int maximum(void) const;
 
+	private:
+
+		int m_minimum;
+		int m_maximum;
+
 	public: /* virtual */
 
 		VIRTUAL const Core::Type & type(void) const
@@ -79,6 +83,9 @@ namespace Event { /****************************************** Event Namespace */
 	public: /* static */
 
 		static const Core::Type & Type(void);
+
+		/*! @brief Coalescing key (device and axis) */
+		static bool CoalesceKey(const IEvent &event, uint32_t &key);
 	};
 
 } /********************************************************** Event Namespace */
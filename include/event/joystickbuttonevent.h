@@ -52,7 +52,6 @@ namespace Event { /****************************************** Event Namespace */
 	class MARSHMALLOW_EVENT_EXPORT
 	JoystickButtonEvent : public InputEvent
 	{
-		PRIVATE_IMPLEMENTATION
 		NO_ASSIGN_COPY(JoystickButtonEvent);
 	public:
 
@@ -73,6 +72,10 @@ namespace Event { /****************************************** Event Namespace */
 
 		bool pressed(int button) const;
 
+	private:
+
+		int m_state;
+
 	public: /* virtual */
 
 		VIRTUAL const Core::Type & type(void) const
@@ -81,6 +84,9 @@ namespace Event { /****************************************** Event Namespace */
 	public: /* static */
 
 		static const Core::Type & Type(void);
+
+		/*! @brief Subscription key (button) */
+		static bool SubscriptionKey(const IEvent &event, uint32_t &key);
 	};
 
 } /********************************************************** Event Namespace */
@@ -75,6 +75,9 @@ namespace Event { /****************************************** Event Namespace */
 	public: /* static */
 
 		static const Core::Type & Type(void);
+
+		/*! @brief Subscription key (key code) */
+		static bool SubscriptionKey(const IEvent &event, uint32_t &key);
 	};
 
 } /********************************************************** Event Namespace */
@@ -53,9 +53,18 @@ namespace Event { /****************************************** Event Namespace */
 		NO_ASSIGN_COPY(RenderEvent);
 	public:
 
-		RenderEvent(void);
+		/*!
+		 * @param alpha Interpolation alpha between simulation steps
+		 */
+		RenderEvent(float alpha = 1.f);
 		virtual ~RenderEvent(void);
 
+		float alpha(void) const;
+
+	private:
+
+		float m_alpha;
+
 	public: /* virtual */
 
 		VIRTUAL const Core::Type & type(void) const
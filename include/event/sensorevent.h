@@ -52,7 +52,6 @@ namespace Event { /****************************************** Event Namespace */
 	class MARSHMALLOW_EVENT_EXPORT
 	SensorEvent : public InputEvent
 	{
-		PRIVATE_IMPLEMENTATION
 		NO_ASSIGN_COPY(SensorEvent);
 	public:
 
@@ -69,6 +68,12 @@ namespace Event { /****************************************** Event Namespace */
 		float y() const;
 		float z() const;
 
+	private:
+
+		float m_x;
+		float m_y;
+		float m_z;
+
 	public: /* virtual */
 
 		VIRTUAL const Core::Type & type(void) const
@@ -77,6 +82,9 @@ namespace Event { /****************************************** Event Namespace */
 	public: /* static */
 
 		static const Core::Type & Type(void);
+
+		/*! @brief Coalescing key (device and sensor) */
+		static bool CoalesceKey(const IEvent &event, uint32_t &key);
 	};
 
 } /********************************************************** Event Namespace */
@@ -52,7 +52,6 @@ namespace Event { /****************************************** Event Namespace */
 	class MARSHMALLOW_EVENT_EXPORT
 	TouchEvent : public InputEvent
 	{
-		PRIVATE_IMPLEMENTATION
 		NO_ASSIGN_COPY(TouchEvent);
 	public:
 
@@ -68,6 +67,11 @@ namespace Event { /****************************************** Event Namespace */
 		int x() const;
 		int y() const;
 
+	private:
+
+		int m_x;
+		int m_y;
+
 	public: /* virtual */
 
 		VIRTUAL const Core::Type & type(void) const
@@ -76,6 +80,9 @@ namespace Event { /****************************************** Event Namespace */
 	public: /* static */
 
 		static const Core::Type & Type(void);
+
+		/*! @brief Coalescing key (device, move actions only) */
+		static bool CoalesceKey(const IEvent &event, uint32_t &key);
 	};
 
 } /********************************************************** Event Namespace */
@@ -69,12 +69,14 @@ namespace Game { /******************************************** Game Namespace */
 
 		void play(const Core::Identifier &animation, bool loop = false);
 		void stop(uint16_t *tile = 0);
+		bool playing(void) const;
 
 	public: /* virtual */
 
 		VIRTUAL const Core::Type & type(void) const
 		    { return(Type()); }
 
+		VIRTUAL void reset(void);
 		VIRTUAL void update(float d);
 
 	public: /* static */
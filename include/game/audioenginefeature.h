@@ -70,6 +70,9 @@ namespace Game { /******************************************** Game Namespace */
 		VIRTUAL void finalize(void);
 		VIRTUAL void tick(float delta);
 
+		VIRTUAL Affinity affinity(void) const
+		    { return(AnyThread); }
+
 	public: /* static */
 
 		static const Core::Type & Type(void);
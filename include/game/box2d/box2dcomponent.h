@@ -80,6 +80,7 @@ namespace Game { /******************************************** Game Namespace */
 		VIRTUAL const Core::Type & type(void) const
 		    { return(Type()); }
 
+		VIRTUAL void reset(void);
 		VIRTUAL void update(float delta);
 
 	public: /* static */
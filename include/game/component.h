@@ -45,6 +45,19 @@
 
 #include <game/icomponent.h>
 
+#include <new>
+
+/*
+ * Component private implementations go through allocateState(), so pooled
+ * components get theirs placed in pool storage (see ComponentPool).
+ */
+#define COMPONENT_PIMPL_CREATE \
+	PIMPL(new (allocateState(sizeof(Private))) Private)
+#define COMPONENT_PIMPL_CREATE_X(...) \
+	PIMPL(new (allocateState(sizeof(Private))) Private(__VA_ARGS__))
+#define COMPONENT_PIMPL_DESTROY \
+	PIMPL->~Private(), releaseState(PIMPL), PIMPL = 0
+
 MARSHMALLOW_NAMESPACE_BEGIN
 namespace Game { /******************************************** Game Namespace */
 
@@ -68,6 +81,29 @@ namespace Game { /******************************************** Game Namespace */
 
 		VIRTUAL void render(void) {};
 		VIRTUAL void update(float) {};
+
+	public: /* static */
+
+		/*!
+		 * @brief Place private implementations in storage
+		 *
+		 * Components constructed until EndState() place their private
+		 * implementations (see COMPONENT_PIMPL_CREATE) back to back in
+		 * storage instead of allocating them. A null storage only
+		 * measures, state gets allocated as usual. Main thread only.
+		 */
+		static void BeginState(char *storage);
+
+		/*!
+		 * @brief Stop placing private implementations
+		 * @return Bytes of storage used (or needed)
+		 */
+		static size_t EndState(void);
+
+	protected:
+
+		void * allocateState(size_t size);
+		void releaseState(void *state);
 	};
 
 } /*********************************************************** Game Namespace */
@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#pragma once
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+#ifndef MARSHMALLOW_GAME_COMPONENTPOOL_H
+#define MARSHMALLOW_GAME_COMPONENTPOOL_H 1
+
+#include <core/identifier.h>
+#include <core/type.h>
+
+#include <game/component.h>
+#include <game/icomponentpool.h>
+
+#include <map>
+#include <new>
+#include <vector>
+
+MARSHMALLOW_NAMESPACE_BEGIN
+namespace Core { /******************************************** Core Namespace */
+	class Identifier;
+} /*********************************************************** Core Namespace */
+
+namespace Game { /******************************************** Game Namespace */
+
+	/*!
+	 * @brief Game Component Pool Class
+	 *
+	 * Constructs components of type T inside preallocated chunks and
+	 * tracks the live ones in a dense array, so systems can walk every T
+	 * in a layer without going through entities and component churn
+	 * stops hitting the allocator.
+	 *
+	 * Every slot holds a component followed by its private
+	 * implementations (see Component::BeginState), so a component and
+	 * its state share cache lines. Slot size is measured once by
+	 * constructing a throwaway T with no entity.
+	 *
+	 * Pools are owned by an EntitySceneLayer (see
+	 * EntitySceneLayer::addComponentPool), Game::Factory creates
+	 * components from them when the entity layer has a pool for the
+	 * type. Pooled components get added to entities as usual, entities
+	 * hand them back to the layer when destroyed; they must never be
+	 * deleted directly.
+	 */
+	template <class T>
+	class ComponentPool : public IComponentPool
+	{
+		NO_ASSIGN_COPY(ComponentPool);
+
+		typedef std::vector<char *> ChunkList;
+		typedef std::map<const char *, size_t> ChunkMap;
+		typedef std::vector<T *> ComponentList;
+		typedef std::vector<size_t> IndexList;
+
+		ChunkList     m_chunks;
+		ChunkMap      m_chunk_index;
+		ComponentList m_live;
+		ComponentList m_free;
+		IndexList     m_index;
+		size_t        m_chunk_size;
+		size_t        m_stride;
+
+	public:
+
+		/*!
+		 * @param chunk_size Components per storage chunk
+		 */
+		ComponentPool(size_t chunk_size = 64)
+		    : m_chunk_size(chunk_size ? chunk_size : 1)
+		    , m_stride(0) {}
+
+		virtual ~ComponentPool(void);
+
+		/*! @brief Live component at index (dense, unordered) */
+		T * at(size_t index) const
+		    { return(m_live[index]); }
+
+		/*! @brief Component slots allocated */
+		size_t capacity(void) const
+		    { return(m_chunks.size() * m_chunk_size); }
+
+		/*! @brief Preallocate storage for count components */
+		void reserve(size_t count)
+		    { while (capacity() < count) grow(); }
+
+	public: /* reimp */
+
+		VIRTUAL T * create(const Core::Identifier &identifier,
+		                   Game::IEntity *entity);
+
+		VIRTUAL const Core::Type & type(void) const
+		    { return(T::Type()); }
+
+		VIRTUAL size_t size(void) const
+		    { return(m_live.size()); }
+
+		VIRTUAL IComponent * component(size_t index) const
+		    { return(m_live[index]); }
+
+		VIRTUAL bool owns(const IComponent *component) const;
+		VIRTUAL bool release(IComponent *component);
+
+	private:
+
+		void grow(void);
+		size_t slot(const T *component) const;
+
+		/* component object size, rounded up to state alignment */
+		static size_t ObjectSize(void)
+		    { return((sizeof(T) + 2 * sizeof(void *) - 1)
+		        & ~(2 * sizeof(void *) - 1)); }
+	};
+
+	template <class T>
+	ComponentPool<T>::~ComponentPool(void)
+	{
+		while (!m_live.empty()) {
+			m_live.back()->~T();
+			m_live.pop_back();
+		}
+
+		typename ChunkList::const_iterator l_i;
+		for (l_i = m_chunks.begin(); l_i != m_chunks.end(); ++l_i)
+			::operator delete(*l_i);
+	}
+
+	template <class T>
+	T *
+	ComponentPool<T>::create(const Core::Identifier &i, Game::IEntity *e)
+	{
+		if (m_free.empty())
+			grow();
+
+		/* private implementations go right behind the component */
+		char *l_slot = reinterpret_cast<char *>(m_free.back());
+		Component::BeginState(l_slot + ObjectSize());
+		T *l_component = new(l_slot) T(i, e);
+		Component::EndState();
+		m_free.pop_back();
+
+		m_index[slot(l_component)] = m_live.size();
+		m_live.push_back(l_component);
+		return(l_component);
+	}
+
+	template <class T>
+	bool
+	ComponentPool<T>::owns(const IComponent *c) const
+	{
+		if (!c || c->type() != T::Type())
+			return(false);
+		return(slot(static_cast<const T *>(c)) < capacity());
+	}
+
+	template <class T>
+	bool
+	ComponentPool<T>::release(IComponent *c)
+	{
+		if (!owns(c))
+			return(false);
+
+		T *l_component = static_cast<T *>(c);
+
+		/* swap with last live component to keep the array dense */
+		const size_t l_pos = m_index[slot(l_component)];
+		T *l_last = m_live.back();
+		m_live[l_pos] = l_last;
+		m_index[slot(l_last)] = l_pos;
+		m_live.pop_back();
+
+		l_component->~T();
+		m_free.push_back(l_component);
+		return(true);
+	}
+
+	template <class T>
+	void
+	ComponentPool<T>::grow(void)
+	{
+		/* measure private implementations once */
+		if (!m_stride) {
+			Component::BeginState(0);
+			{ T l_probe(Core::Identifier(), 0); }
+			m_stride = ObjectSize() + Component::EndState();
+		}
+
+		char *l_chunk = static_cast<char *>
+		    (::operator new(m_chunk_size * m_stride));
+		m_chunk_index[l_chunk] = m_chunks.size();
+		m_chunks.push_back(l_chunk);
+		m_index.resize(capacity());
+		m_live.reserve(capacity());
+
+		/* reversed, so slots get used in address order */
+		for (size_t l_i = m_chunk_size; l_i > 0; --l_i)
+			m_free.push_back(reinterpret_cast<T *>
+			    (l_chunk + (l_i - 1) * m_stride));
+	}
+
+	template <class T>
+	size_t
+	ComponentPool<T>::slot(const T *c) const
+	{
+		const char *l_c = reinterpret_cast<const char *>(c);
+
+		/* chunk starting at or right before the component */
+		typename ChunkMap::const_iterator l_i =
+		    m_chunk_index.upper_bound(l_c);
+		if (l_i == m_chunk_index.begin())
+			return(capacity());
+		--l_i;
+
+		const size_t l_offset = static_cast<size_t>(l_c - l_i->first);
+		if (l_offset >= m_chunk_size * m_stride || l_offset % m_stride)
+			return(capacity());
+
+		return(l_i->second * m_chunk_size + l_offset / m_stride);
+	}
+
+} /*********************************************************** Game Namespace */
+MARSHMALLOW_NAMESPACE_END
+
+#endif
@@ -56,6 +56,8 @@ namespace Event { /****************************************** Event Namespace */
 namespace Game { /******************************************** Game Namespace */
 
 	class EngineEventListener;
+	class FramePacer;
+	class FrameStats;
 	class SceneManager;
 	struct IFactory;
 
@@ -111,6 +113,26 @@ namespace Game { /******************************************** Game Namespace */
 		 */
 		void setFrameRateMax(unsigned short rate);
 
+		/*!
+		 * @brief Set fixed simulation step
+		 *
+		 * Update events are dispatched as many times per frame as
+		 * needed to consume elapsed time in steps of this length,
+		 * setting step to zero reverts to one variable length update
+		 * per frame.
+		 */
+		void setFixedStep(float step);
+
+		/*!
+		 * @brief Frame deadline pacing, used when vsync is off
+		 */
+		const Game::FramePacer & framePacer(void) const;
+
+		/*!
+		 * @brief Time the last tick of a feature took
+		 */
+		MMTIME featureTime(const Core::Type &type) const;
+
 	public: /* virtual */
 
 	public: /* reimp */
@@ -127,6 +149,11 @@ namespace Game { /******************************************** Game Namespace */
 
 		VIRTUAL bool isSuspended(void) const;
 
+		VIRTUAL float fixedStep(void) const;
+		VIRTUAL uint32_t stepCount(void) const;
+		VIRTUAL float interpolation(void) const;
+		VIRTUAL const Game::FrameStats & frameStats(void) const;
+
 		VIRTUAL bool handleEvent(const Event::IEvent &event);
 
 		VIRTUAL void addFeature(Game::IEngineFeature *feature);
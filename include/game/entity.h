@@ -62,6 +62,13 @@ namespace Game { /******************************************** Game Namespace */
 		       Game::EntitySceneLayer *layer);
 		virtual ~Entity(void);
 
+		/*!
+		 * @brief Revive entity and reset every component
+		 *
+		 * Used by EntityPool to recycle killed entities.
+		 */
+		void reset(void);
+
 	public: /* reimp */
 
 		VIRTUAL const Core::Identifier & id(void) const;
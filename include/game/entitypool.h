@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#pragma once
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+#ifndef MARSHMALLOW_GAME_ENTITYPOOL_H
+#define MARSHMALLOW_GAME_ENTITYPOOL_H 1
+
+#include <core/environment.h>
+#include <core/global.h>
+#include <core/namespace.h>
+
+#include <cstddef>
+
+MARSHMALLOW_NAMESPACE_BEGIN
+namespace Core { /******************************************** Core Namespace */
+	class Identifier;
+	class Type;
+} /*********************************************************** Core Namespace */
+
+namespace Game { /******************************************** Game Namespace */
+
+	class Entity;
+	class EntitySceneLayer;
+
+	struct IEntity;
+
+	/*!
+	 * @brief Game Entity Pool Class
+	 *
+	 * Recycles entities sharing an identifier and a component set, meant
+	 * for high churn spawns (bullets, particles). Entities are built
+	 * ahead of time and moved in and out of the layer without touching
+	 * the heap, killing an acquired entity returns it to the pool once
+	 * the layer reclaims it.
+	 *
+	 * Pools must be registered with their layer (see
+	 * EntitySceneLayer::addEntityPool), which owns them.
+	 */
+	class MARSHMALLOW_GAME_EXPORT
+	EntityPool
+	{
+		PRIVATE_IMPLEMENTATION
+		NO_ASSIGN_COPY(EntityPool);
+	public:
+
+		/*!
+		 * @param identifier Identifier of every pooled entity
+		 * @param layer Layer pooled entities live in
+		 */
+		EntityPool(const Core::Identifier &identifier,
+		           Game::EntitySceneLayer *layer);
+		~EntityPool(void);
+
+		/*!
+		 * @brief Add a component to the set of every pooled entity
+		 *
+		 * Components are created through Game::Factory, only affects
+		 * entities constructed afterwards.
+		 */
+		void addComponent(const Core::Type &type,
+		                  const Core::Identifier &identifier);
+
+		/*! @brief Pre-construct entities until count are available */
+		void reserve(size_t count);
+
+		/*!
+		 * @brief Move a pooled entity into the layer
+		 *
+		 * A new entity gets constructed if none are available.
+		 */
+		Game::Entity * acquire(void);
+
+		/*!
+		 * @brief Move an acquired entity back into the pool
+		 *
+		 * Components get reset (see IComponent::reset), the entity is
+		 * the next one to be acquired.
+		 */
+		void release(Game::IEntity *entity);
+
+		/*! @brief Entities ready to be acquired */
+		size_t available(void) const;
+
+		/*! @brief Entities constructed by the pool */
+		size_t size(void) const;
+
+		Game::EntitySceneLayer * layer(void) const;
+	};
+
+} /*********************************************************** Game Namespace */
+MARSHMALLOW_NAMESPACE_END
+
+#endif
@@ -48,6 +48,10 @@
 MARSHMALLOW_NAMESPACE_BEGIN
 namespace Game { /******************************************** Game Namespace */
 
+	class EntityPool;
+
+	struct IComponent;
+	struct IComponentPool;
 	struct IEntity;
 	typedef std::list<IEntity *> EntityList;
 
@@ -70,6 +74,50 @@ namespace Game { /******************************************** Game Namespace */
 		Game::IEntity * getEntity(const Core::Identifier &identifier) const;
 		const EntityList & getEntities(void) const;
 
+		/*!
+		 * @brief Move the first entity of list into the layer
+		 *
+		 * The list node is spliced in, nothing gets allocated. Killed
+		 * entities adopted on behalf of a pool go back to it instead
+		 * of being deleted. An entity already in the layer is left in
+		 * list.
+		 */
+		void adoptEntity(EntityList &list, Game::EntityPool *pool = 0);
+
+		/*!
+		 * @brief Move entity out of the layer into list
+		 * @return false if entity isn't in the layer
+		 */
+		bool abandonEntity(Game::IEntity *entity, EntityList &list);
+
+		/*!
+		 * @brief Register an entity pool, layer takes ownership
+		 */
+		void addEntityPool(Game::EntityPool *pool);
+
+		/*!
+		 * @brief Register a component pool, layer takes ownership
+		 *
+		 * Only one pool per component type is allowed, pools outlive
+		 * every entity in the layer.
+		 */
+		void addComponentPool(Game::IComponentPool *pool);
+		Game::IComponentPool * componentPool(const Core::Type &type) const;
+
+		/*!
+		 * @brief Return a component to its pool
+		 * @return false if component isn't pooled by this layer
+		 */
+		bool releaseComponent(Game::IComponent *component);
+
+		/*!
+		 * @brief Zombie entities reclaimed during the last frame
+		 *
+		 * Killed entities are swept at the end of every update, the
+		 * count covers every update since the previous render.
+		 */
+		size_t reclaimed(void) const;
+
 		bool visiblityTesting(void) const;
 		void setVisibilityTesting(bool value);
 
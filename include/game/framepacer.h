@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#pragma once
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+#ifndef MARSHMALLOW_GAME_FRAMEPACER_H
+#define MARSHMALLOW_GAME_FRAMEPACER_H 1
+
+#include <core/environment.h>
+#include <core/global.h>
+#include <core/namespace.h>
+
+MARSHMALLOW_NAMESPACE_BEGIN
+namespace Game { /******************************************** Game Namespace */
+
+	/*!
+	 * @brief Frame Pacer
+	 *
+	 * Blocks until the next frame deadline, sleeping through most of
+	 * the wait and spinning for the last stretch since sleeps tend to
+	 * overshoot. Deadlines advance by one period each frame, a frame
+	 * that arrives late re-anchors them instead of trying to catch up.
+	 */
+	class MARSHMALLOW_GAME_EXPORT
+	FramePacer
+	{
+		PRIVATE_IMPLEMENTATION
+		NO_ASSIGN_COPY(FramePacer);
+	public:
+
+		/*!
+		 * @param period Frame period in seconds, zero disables pacing
+		 * @param spin Time before a deadline spent spinning
+		 */
+		FramePacer(MMTIME period = 0, MMTIME spin = .001);
+		~FramePacer(void);
+
+		/*! @brief Frame period */
+		MMTIME period(void) const;
+
+		/*! @brief Set frame period, re-anchors deadline */
+		void setPeriod(MMTIME period);
+
+		/*! @brief Spin tail length */
+		MMTIME spin(void) const;
+
+		/*! @brief Set spin tail length */
+		void setSpin(MMTIME spin);
+
+		/*! @brief Next deadline starts one period from now */
+		void reset(void);
+
+		/*! @brief Block until next deadline */
+		void wait(void);
+
+	public: /* statistics */
+
+		/*! @brief Deadlines waited on */
+		uint32_t frames(void) const;
+
+		/*! @brief Deadlines that had already passed */
+		uint32_t missed(void) const;
+
+		/*! @brief Average wake up lateness of deadlines hit */
+		MMTIME error(void) const;
+
+		/*! @brief Worst wake up lateness of deadlines hit */
+		MMTIME errorMax(void) const;
+
+		/*! @brief Total time spent sleeping */
+		MMTIME slept(void) const;
+
+		/*! @brief Total time spent spinning */
+		MMTIME spun(void) const;
+
+		/*! @brief Forget statistics */
+		void resetStats(void);
+	};
+
+} /*********************************************************** Game Namespace */
+MARSHMALLOW_NAMESPACE_END
+
+#endif
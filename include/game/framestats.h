@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#pragma once
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+#ifndef MARSHMALLOW_GAME_FRAMESTATS_H
+#define MARSHMALLOW_GAME_FRAMESTATS_H 1
+
+#include <core/environment.h>
+#include <core/global.h>
+#include <core/namespace.h>
+
+MARSHMALLOW_NAMESPACE_BEGIN
+namespace Game { /******************************************** Game Namespace */
+
+	/*!
+	 * @brief Frame Phase Statistics
+	 *
+	 * Keeps the per-phase timings (in seconds) of the last frames in a
+	 * ring buffer, queries only look at the frames currently held.
+	 */
+	class MARSHMALLOW_GAME_EXPORT
+	FrameStats
+	{
+		PRIVATE_IMPLEMENTATION
+		NO_ASSIGN_COPY(FrameStats);
+	public:
+
+		/*! @brief Frame Phases */
+		enum Phase
+		{
+			BackendTick = 0,  /*!< Graphics::Backend::Tick() */
+			FeatureTick,      /*!< engine feature tick() */
+			EventExecute,     /*!< EventManager::execute() */
+			Update,           /*!< engine update() */
+			UpdateDispatch,   /*!< UpdateEvent dispatch */
+			Render,           /*!< painter setup and engine render() */
+			RenderDispatch,   /*!< RenderEvent dispatch */
+			BackendFinish,    /*!< Graphics::Backend::Finish() */
+			Frame,            /*!< whole frame */
+			Phases            /*!< Phase Count */
+		};
+
+	public:
+
+		/*!
+		 * @param capacity Number of frames kept
+		 */
+		FrameStats(size_t capacity = 256);
+		~FrameStats(void);
+
+		/*! @brief Record time spent in phase during current frame */
+		void record(Phase phase, MMTIME time);
+
+		/*! @brief Close current frame, next record() starts a new one */
+		void commit(void);
+
+		/*! @brief Forget every frame */
+		void reset(void);
+
+		/*! @brief Ring buffer capacity */
+		size_t capacity(void) const;
+
+		/*! @brief Resize ring buffer, forgets every frame */
+		void setCapacity(size_t capacity);
+
+		/*! @brief Number of frames held */
+		size_t frames(void) const;
+
+		/*! @brief Number of frames committed since reset */
+		size_t total(void) const;
+
+		/*! @brief Phase time of the last committed frame */
+		MMTIME last(Phase phase) const;
+
+		/*! @brief Average phase time */
+		MMTIME average(Phase phase) const;
+
+		/*!
+		 * @brief Phase time percentile
+		 * @param percent Percentile (0-100), nearest-rank
+		 */
+		MMTIME percentile(Phase phase, float percent) const;
+
+		/*! @brief Worst phase time */
+		MMTIME worst(Phase phase) const;
+
+	public: /* static */
+
+		static const char * PhaseName(Phase phase);
+	};
+
+} /*********************************************************** Game Namespace */
+MARSHMALLOW_NAMESPACE_END
+
+#endif
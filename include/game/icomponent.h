@@ -67,6 +67,14 @@ namespace Game { /******************************************** Game Namespace */
 
 		virtual const Core::Identifier & id(void) const = 0;
 		virtual const Core::Type & type(void) const = 0;
+
+		/*!
+		 * @brief Clear runtime state for reuse
+		 *
+		 * Called when a pooled entity is released (see EntityPool),
+		 * configuration (meshes, sizes, limits, flags) is kept.
+		 */
+		virtual void reset(void);
 	};
 
 } /*********************************************************** Game Namespace */
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#pragma once
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+#ifndef MARSHMALLOW_GAME_ICOMPONENTPOOL_H
+#define MARSHMALLOW_GAME_ICOMPONENTPOOL_H 1
+
+#include <core/environment.h>
+#include <core/global.h>
+#include <core/namespace.h>
+
+#include <cstddef>
+
+MARSHMALLOW_NAMESPACE_BEGIN
+namespace Core { /******************************************** Core Namespace */
+	class Identifier;
+	class Type;
+} /*********************************************************** Core Namespace */
+
+namespace Game { /******************************************** Game Namespace */
+
+	struct IComponent;
+	struct IEntity;
+
+	/*! @brief Game Component Pool Interface */
+	struct MARSHMALLOW_GAME_EXPORT
+	IComponentPool
+	{
+		virtual ~IComponentPool(void);
+
+		/*! @brief Construct a pooled component */
+		virtual IComponent * create(const Core::Identifier &identifier,
+		                            Game::IEntity *entity) = 0;
+
+		/*! @brief Type of the components held */
+		virtual const Core::Type & type(void) const = 0;
+
+		/*! @brief Live component count */
+		virtual size_t size(void) const = 0;
+
+		/*! @brief Live component at index (dense, unordered) */
+		virtual IComponent * component(size_t index) const = 0;
+
+		/*! @brief Whether component storage belongs to this pool */
+		virtual bool owns(const IComponent *component) const = 0;
+
+		/*!
+		 * @brief Destroy a pooled component
+		 * @return false if the component isn't owned by this pool
+		 */
+		virtual bool release(IComponent *component) = 0;
+	};
+
+} /*********************************************************** Game Namespace */
+MARSHMALLOW_NAMESPACE_END
+
+#endif
@@ -52,6 +52,7 @@ namespace Event { /****************************************** Event Namespace */
 
 namespace Game { /******************************************** Game Namespace */
 
+	class FrameStats;
 	class SceneManager;
 	struct IEngineFeature;
 	struct IFactory;
@@ -88,6 +89,34 @@ namespace Game { /******************************************** Game Namespace */
 		 */
 		virtual bool isSuspended(void) const = 0;
 
+		/*
+		 * Simulation
+		 */
+
+		/*!
+		 * @brief Fixed simulation step (seconds), zero if variable
+		 */
+		virtual float fixedStep(void) const = 0;
+
+		/*!
+		 * @brief Number of simulation steps taken so far
+		 */
+		virtual uint32_t stepCount(void) const = 0;
+
+		/*!
+		 * @brief Render interpolation alpha
+		 *
+		 * Fraction (0-1) of a fixed step left over after the last
+		 * simulation step, used to blend between the previous and the
+		 * current simulation state while rendering.
+		 */
+		virtual float interpolation(void) const = 0;
+
+		/*!
+		 * @brief Per-phase timings of the last frames
+		 */
+		virtual const Game::FrameStats & frameStats(void) const = 0;
+
 		/*!
 		 * @brief Event Manager
 		 */
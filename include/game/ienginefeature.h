@@ -55,6 +55,13 @@ namespace Game { /******************************************** Game Namespace */
 	struct MARSHMALLOW_GAME_EXPORT
 	IEngineFeature
 	{
+		/*! @brief Thread a feature can be ticked on */
+		enum Affinity
+		{
+			MainThread, /*!< Engine thread only (default) */
+			AnyThread   /*!< Job worker threads too */
+		};
+
 		virtual ~IEngineFeature(void);
 
 		/*!
@@ -76,6 +83,21 @@ namespace Game { /******************************************** Game Namespace */
 		 * @brief Feature tick
 		 */
 		virtual void tick(float delta) = 0;
+
+		/*!
+		 * @brief Feature tick thread affinity
+		 *
+		 * Features on any thread get ticked concurrently with others,
+		 * the event manager isn't thread safe so features that queue
+		 * events need to stay on the main thread.
+		 */
+		virtual Affinity affinity(void) const;
+
+		/*!
+		 * @brief Feature tick ordering
+		 * @return True if features of type need to be ticked first
+		 */
+		virtual bool dependsOn(const Core::Type &type) const;
 	};
 
 } /*********************************************************** Game Namespace */
@@ -93,6 +93,7 @@ namespace Game { /******************************************** Game Namespace */
 		VIRTUAL const Core::Type & type(void) const
 		    { return(Type()); }
 
+		VIRTUAL void reset(void);
 		VIRTUAL void update(float d);
 
 	public: /* static */
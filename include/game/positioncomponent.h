@@ -60,9 +60,26 @@ namespace Game { /******************************************** Game Namespace */
 		virtual ~PositionComponent(void);
 
 		const Math::Point2 & position(void) const;
+
+		/*!
+		 * @brief Position blended by the engine interpolation alpha
+		 *
+		 * Position between the one held before the last simulation
+		 * step and the current one, meant for rendering.
+		 */
+		Math::Point2 interpolated(void) const;
+
 		void setPosition(const Math::Point2 &pos);
 		void setPosition(float x, float y);
 
+		/*!
+		 * @brief Jump to position
+		 *
+		 * Unlike setPosition(), the move is never interpolated.
+		 */
+		void teleport(const Math::Point2 &pos);
+		void teleport(float x, float y);
+
 		float positionX(void) const;
 		void setPositionX(float x);
 
@@ -79,6 +96,8 @@ namespace Game { /******************************************** Game Namespace */
 		VIRTUAL const Core::Type & type(void) const
 		    { return(Type()); }
 
+		VIRTUAL void reset(void);
+
 	public: /* static */
 
 		static const Core::Type & Type(void);
@@ -50,6 +50,11 @@
 #include <event/ieventlistener.h>
 
 MARSHMALLOW_NAMESPACE_BEGIN
+namespace Event { /****************************************** Event Namespace */
+	class RenderEvent;
+	class UpdateEvent;
+} /********************************************************** Event Namespace */
+
 namespace Game { /******************************************** Game Namespace */
 
 	struct IScene;
@@ -79,6 +84,11 @@ namespace Game { /******************************************** Game Namespace */
 		VIRTUAL void update(float delta);
 
 		VIRTUAL bool handleEvent(const Event::IEvent &event);
+
+	private:
+
+		bool handleRenderEvent(const Event::RenderEvent &event);
+		bool handleUpdateEvent(const Event::UpdateEvent &event);
 	};
 
 } /*********************************************************** Game Namespace */
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#pragma once
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+#ifndef MARSHMALLOW_GAME_STEPCLOCK_H
+#define MARSHMALLOW_GAME_STEPCLOCK_H 1
+
+#include <core/environment.h>
+#include <core/global.h>
+#include <core/namespace.h>
+
+MARSHMALLOW_NAMESPACE_BEGIN
+namespace Game { /******************************************** Game Namespace */
+
+	/*!
+	 * @brief Simulation Step Clock
+	 *
+	 * Consumes elapsed time in whole fixed steps, the remainder carries
+	 * over to the next frame and doubles as the render interpolation
+	 * alpha. A frame runs at most a capped number of steps, time beyond
+	 * that is dropped in whole steps instead of spiraling. Without a
+	 * step every frame is a single variable length step.
+	 */
+	class MARSHMALLOW_GAME_EXPORT
+	StepClock
+	{
+		PRIVATE_IMPLEMENTATION
+		NO_ASSIGN_COPY(StepClock);
+	public:
+
+		/*!
+		 * @param step Fixed step in seconds, zero for variable steps
+		 * @param max_steps Steps allowed per frame
+		 */
+		StepClock(float step = 0, int max_steps = 8);
+		~StepClock(void);
+
+		/*! @brief Fixed step, zero if variable */
+		float step(void) const;
+
+		/*! @brief Set fixed step, drops accumulated time */
+		void setStep(float step);
+
+		/*! @brief Steps allowed per frame */
+		int maxSteps(void) const;
+
+		/*! @brief Drop accumulated time */
+		void reset(void);
+
+		/*!
+		 * @brief Add elapsed frame time
+		 * @return Steps to run this frame
+		 */
+		int advance(float delta);
+
+		/*! @brief Fraction (0-1) of a step left over, one if variable */
+		float alpha(void) const;
+
+		/*! @brief Steps dropped so far for falling behind */
+		uint32_t dropped(void) const;
+	};
+
+} /*********************************************************** Game Namespace */
+MARSHMALLOW_NAMESPACE_END
+
+#endif
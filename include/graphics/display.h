@@ -54,6 +54,7 @@ namespace Graphics { /************************************ Graphics Namespace */
 		uint8_t  depth;
 		uint8_t  vsync;
 		bool     fullscreen;
+		bool     nowait;     /*!< never block on swap (benchmarking) */
 	};
 
 } /******************************************************* Graphics Namespace */
@@ -121,6 +121,12 @@ namespace Painter { /**************************** Graphics::Painter Namespace */
 	MARSHMALLOW_GRAPHICS_EXPORT
 	void Draw(const IMesh &mesh, const Math::Point2 *origins, size_t count = 1);
 
+	/*!
+	 * Draw calls issued during the last frame.
+	 */
+	MARSHMALLOW_GRAPHICS_EXPORT
+	size_t DrawCalls(void);
+
 } /********************************************** Graphics::Painter Namespace */
 } /******************************************************* Graphics Namespace */
 MARSHMALLOW_NAMESPACE_END
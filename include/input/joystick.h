@@ -105,6 +105,13 @@ namespace Joystick { /***************************** Input::Joystick Namespace */
 		JSB_UP      = (1 << 14)
 	};
 
+	/*!
+	 * @brief Pressed buttons (bitmask) of a joystick
+	 * @param joystick Joystick (event source) id
+	 */
+	MARSHMALLOW_INPUT_EXPORT
+	int ButtonState(size_t joystick);
+
 } /************************************************ Input::Joystick Namespace */
 } /********************************************************** Input Namespace */
 MARSHMALLOW_NAMESPACE_END
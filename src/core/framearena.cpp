@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#include "core/framearena.h"
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+#include <cassert>
+#include <cstdlib>
+#include <vector>
+
+MARSHMALLOW_NAMESPACE_BEGIN
+namespace Core { /******************************************** Core Namespace */
+namespace { /************************************ Core::<anonymous> Namespace */
+
+struct Block
+{
+	char   *data;
+	size_t  size;
+};
+
+} /********************************************** Core::<anonymous> Namespace */
+
+struct FrameArena::Private
+{
+	Private(size_t size)
+	    : block_size(size > 0 ? size : 1)
+	    , current(0)
+	    , offset(0)
+	    , used(0)
+	    , peak(0)
+	{}
+
+	~Private(void)
+	    { release(); }
+
+	inline bool
+	push(size_t size);
+
+	inline void
+	release(void);
+
+	std::vector<Block> blocks;
+	size_t block_size;
+	size_t current;
+	size_t offset;
+	size_t used;
+	size_t peak;
+};
+
+bool
+FrameArena::Private::push(size_t size)
+{
+	Block l_block;
+	l_block.size = size;
+	if (!(l_block.data = static_cast<char *>(malloc(size))))
+		return(false);
+	blocks.push_back(l_block);
+	return(true);
+}
+
+void
+FrameArena::Private::release(void)
+{
+	for (size_t i = 0; i < blocks.size(); ++i)
+		free(blocks[i].data);
+	blocks.clear();
+}
+
+FrameArena::FrameArena(size_t s)
+    : PIMPL_CREATE_X(s)
+{
+}
+
+FrameArena::~FrameArena(void)
+{
+	PIMPL_DESTROY;
+}
+
+void *
+FrameArena::allocate(size_t s, size_t a)
+{
+	assert(a > 0 && 0 == (a & (a - 1)) && "Alignment must be a power of two!");
+
+	/* find a block with enough room, chaining a new one if needed */
+	for (;;) {
+		if (PIMPL->current < PIMPL->blocks.size()) {
+			const Block &l_block = PIMPL->blocks[PIMPL->current];
+			const size_t l_base = reinterpret_cast<size_t>(l_block.data);
+			const size_t l_offset =
+			    ((l_base + PIMPL->offset + a - 1) & ~(a - 1)) - l_base;
+
+			if (l_offset + s <= l_block.size) {
+				PIMPL->used += l_offset + s - PIMPL->offset;
+				PIMPL->offset = l_offset + s;
+				if (PIMPL->used > PIMPL->peak)
+					PIMPL->peak = PIMPL->used;
+				return(l_block.data + l_offset);
+			}
+
+			/* exhausted, its unused tail counts towards used() */
+			PIMPL->used += l_block.size - PIMPL->offset;
+			++PIMPL->current, PIMPL->offset = 0;
+		}
+
+		if (PIMPL->current == PIMPL->blocks.size()
+		    && !PIMPL->push(MMMAX(PIMPL->block_size, s + a)))
+			return(0);
+	}
+}
+
+void
+FrameArena::reset(void)
+{
+	/* merge overflow blocks so the next frame fits in a single one */
+	if (PIMPL->blocks.size() > 1) {
+		size_t l_size = 0;
+		for (size_t i = 0; i < PIMPL->blocks.size(); ++i)
+			l_size += PIMPL->blocks[i].size;
+		PIMPL->release();
+		PIMPL->block_size = l_size;
+		PIMPL->push(l_size);
+	}
+
+	PIMPL->current = PIMPL->offset = PIMPL->used = 0;
+}
+
+size_t
+FrameArena::used(void) const
+{
+	return(PIMPL->used);
+}
+
+size_t
+FrameArena::capacity(void) const
+{
+	size_t l_size = 0;
+	for (size_t i = 0; i < PIMPL->blocks.size(); ++i)
+		l_size += PIMPL->blocks[i].size;
+	return(l_size);
+}
+
+size_t
+FrameArena::peak(void) const
+{
+	return(PIMPL->peak);
+}
+
+FrameArena &
+FrameArena::Instance(void)
+{
+	static FrameArena s_instance;
+	return(s_instance);
+}
+
+} /*********************************************************** Core Namespace */
+MARSHMALLOW_NAMESPACE_END
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2011-2013, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+#pragma once
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+#ifndef MARSHMALLOW_CORE_HASHTABLE_P_H
+#define MARSHMALLOW_CORE_HASHTABLE_P_H 1
+
+#include <core/environment.h>
+#include <core/namespace.h>
+#include <core/global.h>
+
+#include <vector>
+
+#define HASH_TABLE_BITS 6 /* initial capacity, as a power of two */
+
+MARSHMALLOW_NAMESPACE_BEGIN
+namespace Core { /******************************************** Core Namespace */
+
+	/*
+	 * Fibonacci hashing, tables take the high bits of the result since
+	 * the low bits of the product only depend on the low bits of the key.
+	 */
+	inline uint32_t
+	HashKey(uint32_t key)
+	    { return(key * 2654435761u); }
+
+	inline uint32_t
+	HashKey(const void *key)
+	{
+		const uint64_t l_key = reinterpret_cast<size_t>(key) >> 3;
+		return(HashKey(static_cast<uint32_t>(l_key ^ (l_key >> 32))));
+	}
+
+	/*
+	 * Open-addressing hash table with backward shift deletion, values
+	 * are default constructed on insert.
+	 */
+	template <typename K, typename V>
+	class HashTable
+	{
+		NO_ASSIGN_COPY(HashTable);
+
+		struct Slot
+		{
+			K key;
+			V value;
+			bool used;
+		};
+		typedef std::vector<Slot> SlotList;
+
+		SlotList m_slots;
+		size_t m_used;
+		int m_shift;
+
+		static size_t
+		home(K key, int shift)
+		    { return(HashKey(key) >> shift); }
+
+		static size_t
+		probe(const SlotList &slots, int shift, K key)
+		{
+			/* capacity is always a power of two */
+			const size_t l_mask = slots.size() - 1;
+			size_t l_i = home(key, shift);
+			while (slots[l_i].used && slots[l_i].key != key)
+				l_i = (l_i + 1) & l_mask;
+			return(l_i);
+		}
+
+		void
+		grow(void)
+		{
+			Slot l_empty;
+			l_empty.used = false;
+
+			const int l_shift = m_slots.empty()
+			    ? 32 - HASH_TABLE_BITS : m_shift - 1;
+			SlotList l_slots(size_t(1) << (32 - l_shift), l_empty);
+
+			for (size_t i = 0; i < m_slots.size(); ++i) {
+				const Slot &l_slot = m_slots[i];
+				if (l_slot.used)
+					l_slots[probe(l_slots, l_shift,
+					    l_slot.key)] = l_slot;
+			}
+
+			m_slots.swap(l_slots);
+			m_shift = l_shift;
+		}
+
+	public:
+
+		HashTable(void)
+		    : m_used(0)
+		    , m_shift(32)
+		{}
+
+		size_t
+		size(void) const
+		    { return(m_used); }
+
+		size_t
+		capacity(void) const
+		    { return(m_slots.size()); }
+
+		/* value in slot index, null if unused */
+		V *
+		at(size_t index)
+		    { return(m_slots[index].used ? &m_slots[index].value : 0); }
+
+		V *
+		find(K key)
+		{
+			if (m_slots.empty())
+				return(0);
+
+			Slot &l_slot = m_slots[probe(m_slots, m_shift, key)];
+			return(l_slot.used ? &l_slot.value : 0);
+		}
+
+		const V *
+		find(K key) const
+		{
+			if (m_slots.empty())
+				return(0);
+
+			const Slot &l_slot =
+			    m_slots[probe(m_slots, m_shift, key)];
+			return(l_slot.used ? &l_slot.value : 0);
+		}
+
+		V &
+		insert(K key)
+		{
+			V *l_value = find(key);
+			if (l_value)
+				return(*l_value);
+
+			/* keep load factor under 1/2 */
+			if ((m_used + 1) * 2 > m_slots.size())
+				grow();
+
+			Slot &l_slot = m_slots[probe(m_slots, m_shift, key)];
+			l_slot.key = key;
+			l_slot.value = V();
+			l_slot.used = true;
+			++m_used;
+			return(l_slot.value);
+		}
+
+		void
+		erase(K key)
+		{
+			if (m_slots.empty())
+				return;
+
+			const size_t l_mask = m_slots.size() - 1;
+			size_t l_i = probe(m_slots, m_shift, key);
+			if (!m_slots[l_i].used)
+				return;
+
+			/* shift back followers that would become unreachable */
+			for (size_t l_j = (l_i + 1) & l_mask;
+			     m_slots[l_j].used;
+			     l_j = (l_j + 1) & l_mask) {
+				const size_t l_h =
+				    home(m_slots[l_j].key, m_shift);
+				const bool l_move = l_i <= l_j
+				    ? (l_h <= l_i || l_h > l_j)
+				    : (l_h <= l_i && l_h > l_j);
+				if (l_move) {
+					m_slots[l_i] = m_slots[l_j];
+					l_i = l_j;
+				}
+			}
+
+			m_slots[l_i].used = false;
+			--m_used;
+		}
+	};
+
+} /*********************************************************** Core Namespace */
+MARSHMALLOW_NAMESPACE_END
+
+#endif
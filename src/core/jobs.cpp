@@ -0,0 +1,472 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#include "core/jobs.h"
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+#include "core/atomic.h"
+#include "core/logger.h"
+#include "core/semaphore.h"
+#include "core/thread.h"
+
+#include <deque>
+
+#if defined(_MSC_VER)
+#   define MMTHREADLOCAL __declspec(thread)
+#else
+#   define MMTHREADLOCAL __thread
+#endif
+
+MARSHMALLOW_NAMESPACE_BEGIN
+namespace Core { /******************************************** Core Namespace */
+namespace Jobs { /************************************** Core::Jobs Namespace */
+namespace { /****************************** Core::Jobs::<anonymous> Namespace */
+
+struct Job
+{
+	Function function;
+	RangeFunction range;
+	void *data;
+	size_t begin;
+	size_t end;
+	Counter *counter;
+	const Counter *dependency;
+};
+
+typedef std::deque<Job> JobDeque;
+
+/*
+ * Critical sections are just a few list operations long, contenders spin
+ * on a plain load (not on the compare-and-swap) and back off to the
+ * scheduler if the holder got preempted.
+ */
+struct SpinLock
+{
+	SpinLock(void)
+	    : lock(0)
+	{}
+
+	inline void
+	acquire(void)
+	{
+#define JOBS_LOCK_SPINS 64
+		int l_spins = 0;
+		while (!Atomic::CompareAndSwap(&lock, 0, 1))
+			do {
+				if (++l_spins < JOBS_LOCK_SPINS)
+					Atomic::Pause();
+				else
+					Thread::Relinquish();
+			} while (Atomic::Load(&lock));
+	}
+
+	inline void release(void)
+	    { Atomic::CompareAndSwap(&lock, 1, 0); }
+
+	volatile int32_t lock;
+};
+
+struct Worker
+{
+	Worker(void)
+	    : thread(0)
+	{}
+
+	SpinLock lock;
+	JobDeque jobs;
+	Thread *thread;
+};
+
+/*
+ * Threads blocked in Wait(), each one sleeps on its own semaphore so a
+ * wake-up meant for one can't be taken by another.
+ */
+struct Waiter
+{
+	Waiter(void)
+	    : next(0)
+	    , listed(false)
+	{}
+
+	Semaphore wake;
+	Waiter *next;
+	bool listed;
+};
+
+/* worker zero's deque is shared by every non-worker thread */
+Worker          *s_workers(0);
+unsigned int     s_count(0);
+Semaphore       *s_wake(0);
+volatile int32_t s_sleeping(0);
+SpinLock         s_waiters_lock;
+Waiter          *s_waiters(0);
+volatile int32_t s_waiting(0);
+volatile int32_t s_quit(0);
+
+MMTHREADLOCAL unsigned int s_self(0);
+
+inline bool
+IsReady(const Job &job)
+{
+	return(!job.dependency || job.dependency->isDone());
+}
+
+/*
+ * Sleeping workers are interchangeable so one is woken up, blocked
+ * waiters may be waiting on different counters so they all get to take
+ * another look.
+ */
+void
+Wake(void)
+{
+	if (Atomic::Load(&s_sleeping) > 0)
+		s_wake->post();
+
+	if (Atomic::Load(&s_waiting) <= 0)
+		return;
+
+	s_waiters_lock.acquire();
+	for (Waiter *l_waiter = s_waiters; l_waiter;) {
+		Waiter *l_next = l_waiter->next;
+		l_waiter->listed = false;
+		l_waiter->wake.post();
+		Atomic::Decrement(&s_waiting);
+		l_waiter = l_next;
+	}
+	s_waiters = 0;
+	s_waiters_lock.release();
+}
+
+/*
+ * Announces the waiter before the caller takes a last look, see Wake().
+ */
+void
+Enlist(Waiter &waiter)
+{
+	s_waiters_lock.acquire();
+	waiter.next = s_waiters;
+	waiter.listed = true;
+	s_waiters = &waiter;
+	Atomic::Increment(&s_waiting);
+	s_waiters_lock.release();
+}
+
+void
+Delist(Waiter &waiter)
+{
+	s_waiters_lock.acquire();
+	if (waiter.listed) {
+		Waiter **l_link = &s_waiters;
+		while (*l_link != &waiter)
+			l_link = &(*l_link)->next;
+		*l_link = waiter.next;
+		waiter.listed = false;
+		Atomic::Decrement(&s_waiting);
+	}
+	s_waiters_lock.release();
+}
+
+void
+Push(const Job &job)
+{
+	Worker &l_worker = s_workers[s_self];
+
+	if (job.counter)
+		Atomic::Increment(&job.counter->pending);
+
+	l_worker.lock.acquire();
+	l_worker.jobs.push_back(job);
+	l_worker.lock.release();
+
+	Wake();
+}
+
+/*
+ * Own deque is worked newest first (back), other deques are stolen from
+ * oldest first (front). Jobs still waiting on a dependency are skipped.
+ */
+bool
+Take(Job &job)
+{
+	const unsigned int l_deques = s_count + 1;
+
+	for (unsigned int i = 0; i < l_deques; ++i) {
+		Worker &l_worker = s_workers[(s_self + i) % l_deques];
+		bool l_found = false;
+
+		l_worker.lock.acquire();
+		if (i == 0) {
+			JobDeque::reverse_iterator l_j = l_worker.jobs.rbegin();
+			for (; l_j != l_worker.jobs.rend(); ++l_j)
+				if (IsReady(*l_j)) {
+					job = *l_j;
+					l_worker.jobs.erase(--l_j.base());
+					l_found = true;
+					break;
+				}
+		} else {
+			JobDeque::iterator l_j = l_worker.jobs.begin();
+			for (; l_j != l_worker.jobs.end(); ++l_j)
+				if (IsReady(*l_j)) {
+					job = *l_j;
+					l_worker.jobs.erase(l_j);
+					l_found = true;
+					break;
+				}
+		}
+		l_worker.lock.release();
+
+		if (l_found)
+			return(true);
+	}
+
+	return(false);
+}
+
+void
+Execute(const Job &job)
+{
+	if (job.range)
+		job.range(job.data, job.begin, job.end);
+	else
+		job.function(job.data);
+
+	/* a finished counter may unblock dependent jobs */
+	if (job.counter && 0 == Atomic::Decrement(&job.counter->pending))
+		Wake();
+}
+
+void
+WorkerProcedure(void *data)
+{
+	s_self = static_cast<unsigned int>(reinterpret_cast<size_t>(data));
+
+	Job l_job;
+	for (;;) {
+		if (Take(l_job)) {
+			Execute(l_job);
+			continue;
+		}
+
+		if (Atomic::Load(&s_quit))
+			break;
+
+		/* announce sleep before the last look, see Wake() */
+		Atomic::Increment(&s_sleeping);
+		if (Take(l_job)) {
+			Atomic::Decrement(&s_sleeping);
+			Execute(l_job);
+			continue;
+		}
+
+		s_wake->wait();
+		Atomic::Decrement(&s_sleeping);
+	}
+}
+
+} /**************************************** Core::Jobs::<anonymous> Namespace */
+
+bool
+Counter::isDone(void) const
+{
+	return(0 == Atomic::Load(&pending));
+}
+
+void
+Initialize(unsigned int c)
+{
+	if (s_workers) {
+		MMWARNING("Job scheduler already initialized.");
+		return;
+	}
+
+	if (c == 0)
+		c = Thread::HardwareConcurrency() - 1;
+
+	s_count = c;
+	s_quit = 0;
+	s_sleeping = 0;
+	s_waiting = 0;
+	s_waiters = 0;
+	s_wake = new Semaphore;
+	s_workers = new Worker[s_count + 1];
+
+	for (unsigned int i = 1; i <= s_count; ++i) {
+		s_workers[i].thread = new Thread(WorkerProcedure,
+		    reinterpret_cast<void *>(static_cast<size_t>(i)));
+		if (!s_workers[i].thread->start())
+			MMERROR("Failed to start job worker " << i << ".");
+	}
+
+	MMDEBUG("Job scheduler started with " << s_count << " workers.");
+}
+
+void
+Finalize(void)
+{
+	if (!s_workers)
+		return;
+
+	/* workers drain every deque before checking for quit */
+	Atomic::CompareAndSwap(&s_quit, 0, 1);
+	for (unsigned int i = 1; i <= s_count; ++i)
+		s_wake->post();
+
+	for (unsigned int i = 1; i <= s_count; ++i)
+		delete s_workers[i].thread;
+
+	/* leftovers if we had no workers */
+	Job l_job;
+	while (Take(l_job))
+		Execute(l_job);
+
+	delete[] s_workers, s_workers = 0;
+	delete s_wake, s_wake = 0;
+	s_count = 0;
+}
+
+unsigned int
+Workers(void)
+{
+	return(s_count);
+}
+
+void
+Run(Function f, void *d, Counter *c, Counter *dep)
+{
+	Job l_job;
+	l_job.function = f;
+	l_job.range = 0;
+	l_job.data = d;
+	l_job.begin = l_job.end = 0;
+	l_job.counter = c;
+	l_job.dependency = dep;
+
+	/* serial fallback, anything we depend on has already run */
+	if (!s_count) {
+		f(d);
+		return;
+	}
+
+	Push(l_job);
+}
+
+void
+ParallelFor(RangeFunction f, void *d, size_t b, size_t e, size_t g,
+    Counter *c)
+{
+	if (b >= e)
+		return;
+
+	if (!s_count) {
+		f(d, b, e);
+		return;
+	}
+
+	/* aim for a few chunks per thread to even out the load */
+	if (g == 0) {
+#define JOBS_CHUNKS_PER_THREAD 4
+		const size_t l_chunks = (s_count + 1) * JOBS_CHUNKS_PER_THREAD;
+		g = (e - b + l_chunks - 1) / l_chunks;
+	}
+
+	Counter l_local;
+	Counter *l_counter = c ? c : &l_local;
+
+	Job l_job;
+	l_job.function = 0;
+	l_job.range = f;
+	l_job.data = d;
+	l_job.counter = l_counter;
+	l_job.dependency = 0;
+
+	for (size_t i = b; i < e; i += g) {
+		l_job.begin = i;
+		l_job.end = (e - i > g ? i + g : e);
+		Push(l_job);
+	}
+
+	if (!c)
+		Wait(l_local);
+}
+
+void
+Wait(const Counter &c)
+{
+	/* nothing can be running without workers */
+	if (!s_workers)
+		return;
+
+#define JOBS_WAIT_SPINS 128
+	Job l_job;
+	int l_spins = 0;
+	while (!c.isDone()) {
+		if (Take(l_job)) {
+			Execute(l_job);
+			l_spins = 0;
+			continue;
+		}
+
+		/* last jobs are likely about to finish, spin for a bit */
+		if (++l_spins < JOBS_WAIT_SPINS) {
+			Atomic::Pause();
+			continue;
+		}
+
+		/* nothing to help with, block until something happens */
+		Waiter l_waiter;
+		Enlist(l_waiter);
+
+		const bool l_done = c.isDone();
+		const bool l_took = !l_done && Take(l_job);
+		if (!l_done && !l_took)
+			l_waiter.wake.wait();
+
+		Delist(l_waiter);
+
+		if (l_done)
+			break;
+		if (l_took)
+			Execute(l_job);
+		l_spins = 0;
+	}
+}
+
+} /***************************************************** Core::Jobs Namespace */
+} /*********************************************************** Core Namespace */
+MARSHMALLOW_NAMESPACE_END
+
@@ -38,28 +38,42 @@
  * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
  */
 
+#include "core/atomic.h"
+#include "core/thread.h"
+
+#include <map>
+
 MARSHMALLOW_NAMESPACE_BEGIN
 namespace Core { /******************************************** Core Namespace */
+namespace { /************************************ Core::<anonymous> Namespace */
+	typedef std::map<MMUID, int32_t> TypeIndexMap;
+
+	volatile int32_t s_index_lock(0);
+} /********************************************** Core::<anonymous> Namespace */
 
 const Type Type::Null;
 
 Type::Type(void)
     : StrHash()
+    , m_index(-1)
 {
 }
 
 Type::Type(const char *_str)
     : StrHash(_str)
+    , m_index(-1)
 {
 }
 
 Type::Type(const std::string &_str)
     : StrHash(_str)
+    , m_index(-1)
 {
 }
 
 Type::Type(const Type &copy)
     : StrHash(copy)
+    , m_index(copy.m_index)
 {
 }
 
@@ -67,6 +81,28 @@ Type::~Type(void)
 {
 }
 
+int
+Type::assignIndex(void) const
+{
+	while (!Atomic::CompareAndSwap(&s_index_lock, 0, 1))
+		Thread::Relinquish();
+
+	/* function static, types get constructed during static init */
+	static TypeIndexMap s_indexes;
+
+	const MMUID l_uid = uid();
+	TypeIndexMap::const_iterator l_i = s_indexes.find(l_uid);
+	if (l_i == s_indexes.end()) {
+		const int32_t l_index = static_cast<int32_t>(s_indexes.size());
+		l_i = s_indexes.insert
+		    (TypeIndexMap::value_type(l_uid, l_index)).first;
+	}
+	m_index = l_i->second;
+
+	Atomic::CompareAndSwap(&s_index_lock, 1, 0);
+	return(m_index);
+}
+
 } /*********************************************************** Core Namespace */
 MARSHMALLOW_NAMESPACE_END
 
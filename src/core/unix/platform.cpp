@@ -38,13 +38,18 @@
  * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
  */
 
+#include <sys/resource.h>
 #include <sys/time.h>
+#include <cerrno>
 #include <cmath>
 #include <cstdio>
 #include <cstring>
 #include <ctime>
+#include <fcntl.h>
 #include <libgen.h>
+#include <poll.h>
 #include <unistd.h>
+#include <vector>
 
 #include "core/logger.h"
 
@@ -60,6 +65,11 @@ namespace
 #else
 	static struct timeval s_start_time;
 #endif
+
+	/* WaitEvents() descriptors, s_wake[0] is always polled first */
+	static int s_wake[2] = { -1, -1 };
+	static std::vector<struct pollfd> s_poll;
+	static std::vector<Platform::PendingFunction> s_pending;
 } // namespace
 
 /******************************************************************************/
@@ -73,11 +83,34 @@ Platform::Initialize(void)
 	gettimeofday(&s_start_time, 0);
 #endif
 	srand(static_cast<unsigned int>(s_start_time.tv_sec));
+
+	/* wakeup pipe, written to by Wake() */
+	if (-1 == s_wake[0] && 0 == pipe(s_wake)) {
+		for (int i = 0; i < 2; ++i) {
+			fcntl(s_wake[i], F_SETFL,
+			    fcntl(s_wake[i], F_GETFL) | O_NONBLOCK);
+			fcntl(s_wake[i], F_SETFD, FD_CLOEXEC);
+		}
+	}
+	else if (-1 == s_wake[0])
+		MMWARNING("Failed to create wakeup pipe.");
+
+	struct pollfd l_pfd;
+	l_pfd.fd = s_wake[0];
+	l_pfd.events = POLLIN;
+	l_pfd.revents = 0;
+	s_poll.assign(1, l_pfd);
 }
 
 void
 Platform::Finalize(void)
 {
+	s_poll.clear();
+	s_pending.clear();
+
+	for (int i = 0; i < 2; ++i)
+		if (-1 != s_wake[i])
+			close(s_wake[i]), s_wake[i] = -1;
 }
 
 void
@@ -95,6 +128,101 @@ Platform::Sleep(MMTIME timeout)
 	nanosleep(&l_ts, 0);
 }
 
+void
+Platform::WatchDescriptor(int fd)
+{
+	if (-1 == fd || s_poll.empty())
+		return;
+
+	struct pollfd l_pfd;
+	l_pfd.fd = fd;
+	l_pfd.events = POLLIN;
+	l_pfd.revents = 0;
+	s_poll.push_back(l_pfd);
+}
+
+void
+Platform::UnwatchDescriptor(int fd)
+{
+	for (size_t i = 1; i < s_poll.size(); ++i)
+		if (s_poll[i].fd == fd) {
+			s_poll.erase(s_poll.begin() + static_cast<long>(i));
+			return;
+		}
+}
+
+void
+Platform::WatchPending(PendingFunction pending)
+{
+	if (pending)
+		s_pending.push_back(pending);
+}
+
+void
+Platform::UnwatchPending(PendingFunction pending)
+{
+	for (size_t i = 0; i < s_pending.size(); ++i)
+		if (s_pending[i] == pending) {
+			s_pending.erase(s_pending.begin() +
+			    static_cast<long>(i));
+			return;
+		}
+}
+
+bool
+Platform::WaitEvents(MMTIME timeout)
+{
+	/* buffered input never makes its descriptor readable again */
+	for (size_t i = 0; i < s_pending.size(); ++i)
+		if (s_pending[i]())
+			return(true);
+
+	/* only the wakeup pipe, input would go unnoticed */
+	if (s_poll.size() < 2)
+		return(false);
+
+	const int l_timeout = timeout > 0 ?
+	    static_cast<int>(ceil(timeout * 1000.)) : 0;
+
+	int l_c;
+	do l_c = poll(&s_poll[0], s_poll.size(), l_timeout);
+	while (-1 == l_c && EINTR == errno);
+
+	if (l_c <= 0)
+		return(true);
+
+	/* drain wakeup pipe */
+	if (s_poll[0].revents & POLLIN) {
+		char l_buf[32];
+		while (read(s_wake[0], l_buf, sizeof(l_buf)) > 0) {}
+	}
+
+	/*
+	 * Hung up or invalid descriptors stay readable forever, stop
+	 * watching them or every following wait returns right away.
+	 */
+	for (size_t i = s_poll.size() - 1; i > 0; --i)
+		if (s_poll[i].revents & (POLLERR|POLLHUP|POLLNVAL)) {
+			MMWARNING("Descriptor " << s_poll[i].fd
+			    << " failed, no longer watched.");
+			s_poll.erase(s_poll.begin() + static_cast<long>(i));
+		}
+
+	return(true);
+}
+
+void
+Platform::Wake(void)
+{
+	if (-1 == s_wake[1])
+		return;
+
+	const char l_byte = 0;
+	ssize_t l_c;
+	do l_c = write(s_wake[1], &l_byte, 1);
+	while (-1 == l_c && EINTR == errno);
+}
+
 time_t
 Platform::StartTime(void)
 {
@@ -143,6 +271,37 @@ Platform::TimeStampToTimeData(MMTIME timestamp)
 	return(l_ts);
 }
 
+size_t
+Platform::MemoryUsage(void)
+{
+	/* linux, resident pages */
+	int l_fd = open("/proc/self/statm", O_RDONLY);
+	if (-1 != l_fd) {
+		char l_buf[64];
+		const ssize_t l_c = read(l_fd, l_buf, sizeof(l_buf) - 1);
+		close(l_fd);
+
+		unsigned long l_size, l_resident;
+		if (l_c > 0) {
+			l_buf[l_c] = '\0';
+			if (2 == sscanf(l_buf, "%lu %lu", &l_size, &l_resident))
+				return(size_t(l_resident)
+				    * size_t(sysconf(_SC_PAGESIZE)));
+		}
+	}
+
+	/* fallback, peak resident size */
+	struct rusage l_usage;
+	if (0 == getrusage(RUSAGE_SELF, &l_usage))
+#if defined(__APPLE__)
+		return(size_t(l_usage.ru_maxrss));
+#else
+		return(size_t(l_usage.ru_maxrss) * 1024);
+#endif
+
+	return(0);
+}
+
 std::string
 Platform::PathDirectory(const std::string &path)
 {
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#include "core/semaphore.h"
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+#include <pthread.h>
+
+MARSHMALLOW_NAMESPACE_BEGIN
+namespace Core { /******************************************** Core Namespace */
+
+/*
+ * Unnamed POSIX semaphores are not available everywhere (Darwin), so we
+ * build ours out of a mutex and a condition variable.
+ */
+struct Semaphore::Private
+{
+	Private(int c)
+	    : count(c)
+	{
+		pthread_mutex_init(&mutex, 0);
+		pthread_cond_init(&condition, 0);
+	}
+
+	~Private(void)
+	{
+		pthread_cond_destroy(&condition);
+		pthread_mutex_destroy(&mutex);
+	}
+
+	pthread_mutex_t mutex;
+	pthread_cond_t condition;
+	int count;
+};
+
+Semaphore::Semaphore(int c)
+    : PIMPL_CREATE_X(c)
+{
+}
+
+Semaphore::~Semaphore(void)
+{
+	PIMPL_DESTROY;
+}
+
+void
+Semaphore::post(void)
+{
+	pthread_mutex_lock(&PIMPL->mutex);
+	++PIMPL->count;
+	pthread_cond_signal(&PIMPL->condition);
+	pthread_mutex_unlock(&PIMPL->mutex);
+}
+
+void
+Semaphore::wait(void)
+{
+	pthread_mutex_lock(&PIMPL->mutex);
+	while (PIMPL->count <= 0)
+		pthread_cond_wait(&PIMPL->condition, &PIMPL->mutex);
+	--PIMPL->count;
+	pthread_mutex_unlock(&PIMPL->mutex);
+}
+
+bool
+Semaphore::tryWait(void)
+{
+	bool l_acquired = false;
+
+	pthread_mutex_lock(&PIMPL->mutex);
+	if (PIMPL->count > 0) {
+		--PIMPL->count;
+		l_acquired = true;
+	}
+	pthread_mutex_unlock(&PIMPL->mutex);
+
+	return(l_acquired);
+}
+
+} /*********************************************************** Core Namespace */
+MARSHMALLOW_NAMESPACE_END
+
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#include "core/thread.h"
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+#include "core/logger.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+MARSHMALLOW_NAMESPACE_BEGIN
+namespace Core { /******************************************** Core Namespace */
+struct Thread::Private
+{
+	Private(Procedure p, void *d)
+	    : procedure(p)
+	    , data(d)
+	    , running(false)
+	{}
+
+	static void *
+	Entry(void *data)
+	{
+		Private *l_p = static_cast<Private *>(data);
+		l_p->procedure(l_p->data);
+		return(0);
+	}
+
+	Procedure procedure;
+	void *data;
+	pthread_t handle;
+	bool running;
+};
+
+Thread::Thread(Procedure p, void *d)
+    : PIMPL_CREATE_X(p, d)
+{
+}
+
+Thread::~Thread(void)
+{
+	join();
+
+	PIMPL_DESTROY;
+}
+
+bool
+Thread::start(void)
+{
+	if (PIMPL->running)
+		return(false);
+
+	if (0 != pthread_create(&PIMPL->handle, 0, Private::Entry, PIMPL)) {
+		MMERROR("Failed to create thread.");
+		return(false);
+	}
+
+	PIMPL->running = true;
+	return(true);
+}
+
+bool
+Thread::join(void)
+{
+	if (!PIMPL->running)
+		return(false);
+
+	pthread_join(PIMPL->handle, 0);
+	PIMPL->running = false;
+	return(true);
+}
+
+bool
+Thread::isRunning(void) const
+{
+	return(PIMPL->running);
+}
+
+unsigned int
+Thread::HardwareConcurrency(void)
+{
+	const long l_count = sysconf(_SC_NPROCESSORS_ONLN);
+	return(l_count > 0 ? static_cast<unsigned int>(l_count) : 1);
+}
+
+void
+Thread::Relinquish(void)
+{
+	sched_yield();
+}
+
+} /*********************************************************** Core Namespace */
+MARSHMALLOW_NAMESPACE_END
+
@@ -39,7 +39,9 @@
  */
 
 #include <windows.h>
+#include <psapi.h>
 #include <ctime>
+#include <vector>
 
 MARSHMALLOW_NAMESPACE_USE
 using namespace Core;
@@ -49,6 +51,11 @@ using namespace Core;
 namespace
 {
 	static time_t s_start_time = time(0);
+
+	/* signaled by Wake() */
+	static HANDLE s_wake = 0;
+
+	static std::vector<Platform::PendingFunction> s_pending;
 } // namespace
 
 /******************************************************************************/
@@ -56,11 +63,17 @@ namespace
 void
 Platform::Initialize(void)
 {
+	if (!s_wake)
+		s_wake = CreateEvent(0, FALSE, FALSE, 0);
 }
 
 void
 Platform::Finalize(void)
 {
+	s_pending.clear();
+
+	if (s_wake)
+		CloseHandle(s_wake), s_wake = 0;
 }
 
 void
@@ -69,6 +82,58 @@ Platform::Sleep(MMTIME t)
 	if (t > 0) SleepEx(static_cast<DWORD>(t), true);
 }
 
+void
+Platform::WatchDescriptor(int)
+{
+	/* window messages wake WaitEvents() already */
+}
+
+void
+Platform::UnwatchDescriptor(int)
+{
+}
+
+void
+Platform::WatchPending(PendingFunction pending)
+{
+	if (pending)
+		s_pending.push_back(pending);
+}
+
+void
+Platform::UnwatchPending(PendingFunction pending)
+{
+	for (size_t i = 0; i < s_pending.size(); ++i)
+		if (s_pending[i] == pending) {
+			s_pending.erase(s_pending.begin() +
+			    static_cast<long>(i));
+			return;
+		}
+}
+
+bool
+Platform::WaitEvents(MMTIME t)
+{
+	if (!s_wake)
+		return(false);
+
+	/* buffered input never signals again */
+	for (size_t i = 0; i < s_pending.size(); ++i)
+		if (s_pending[i]())
+			return(true);
+
+	MsgWaitForMultipleObjects(1, &s_wake, FALSE,
+	    t > 0 ? static_cast<DWORD>(t) : 0, QS_ALLINPUT);
+	return(true);
+}
+
+void
+Platform::Wake(void)
+{
+	if (s_wake)
+		SetEvent(s_wake);
+}
+
 time_t
 Platform::StartTime(void)
 {
@@ -96,6 +161,16 @@ Platform::TimeStamp(void)
 	return(l_mseconds);
 }
 
+size_t
+Platform::MemoryUsage(void)
+{
+	PROCESS_MEMORY_COUNTERS l_counters;
+	if (!GetProcessMemoryInfo(GetCurrentProcess(), &l_counters,
+	    sizeof(l_counters)))
+		return(0);
+	return(l_counters.WorkingSetSize);
+}
+
 TimeData
 Platform::TimeStampToTimeData(MMTIME timestamp)
 {
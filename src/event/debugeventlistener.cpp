@@ -79,7 +79,7 @@ DebugEventListener::handleEvent(const IEvent &e)
 		    << ": TimeStamp " << e.timeStamp()
 		    << ": Event " << static_cast<const void *>(&e)
 		    << ": Type (" << e.type().uid() << ")" << e.type().str().c_str()
-		    << std::endl;
+		    << '\n';
 
 	return false;
 }
@@ -43,37 +43,26 @@
 MARSHMALLOW_NAMESPACE_BEGIN
 namespace Event { /****************************************** Event Namespace */
 
-struct Event::Private
-{
-	Private(MMTIME t, uint8_t p)
-	    : timestamp(t)
-	    , priority(p)
-	{}
-
-	MMTIME timestamp;
-	uint8_t priority;
-};
-
 Event::Event(MMTIME t, uint8_t p)
-    : PIMPL_CREATE_X(t, p)
+    : m_timestamp(t)
+    , m_priority(p)
 {
 }
 
 Event::~Event(void)
 {
-	PIMPL_DESTROY;
 }
 
 uint8_t
 Event::priority(void) const
 {
-	return(PIMPL->priority);
+	return(m_priority);
 }
 
 MMTIME
 Event::timeStamp(void) const
 {
-	return(PIMPL->timestamp);
+	return(m_timestamp);
 }
 
 } /********************************************************** Event Namespace */
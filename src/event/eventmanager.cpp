@@ -38,6 +38,8 @@
  * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
  */
 
+#include "core/atomic.h"
+#include "core/hashtable_p.h"
 #include "core/identifier.h"
 #include "core/logger.h"
 #include "core/platform.h"
@@ -47,17 +49,71 @@
 #include "event/ieventlistener.h"
 
 #include <algorithm>
-#include <list>
-#include <map>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
 
 /*
  * Implementation Notes
  * ====================
  *
- * The event manager allocates an event list for every event type encountered,
- * this means it will have to deallocate them upon destruction.
+ * The event manager allocates a listener array for every event type
+ * encountered, this means it will have to deallocate them upon destruction.
+ *
+ * Listener arrays are indexed by type uid in an open-addressing (linear
+ * probing) table. Arrays are copy-on-write: dispatch() holds a reference
+ * to the array it walks, connect() and disconnect() on a referenced array
+ * replace it with a modified copy. A listener disconnected mid-dispatch is
+ * also cleared from every array still being walked so it won't be called,
+ * while a listener connected mid-dispatch only receives the next event.
+ *
+ * Listeners connected with a subscription key are kept apart, sorted by key,
+ * dispatch computes the event key once (using the key function of its type)
+ * and only visits the matching range before moving on to unkeyed listeners.
  *
  * Queued events will be automatically freed after execution.
+ *
+ * In concurrent mode, queue() pushes events into a preallocated lock-free ring
+ * (multiple producers, single consumer), posting costs a compare-and-swap and
+ * no allocation. The thread calling execute() is the only consumer, it moves
+ * ring contents (in posting order) into the pending event queue, ordering
+ * happens on the main thread as usual. Should the ring fill up, producers
+ * fall back to an intrusive overflow stack (allocating a node per event) and
+ * keep using it until the consumer detaches it, which preserves per-producer
+ * posting order since the ring is always drained first.
+ *
+ * Event queues are binary heaps ordered by priority (highest first), then
+ * timestamp and finally queue order, so execute() never needs to sort. Events
+ * timestamped in the future are kept in a separate schedule heap ordered by
+ * due time, execute() only moves due events into the active queue so a
+ * delayed event never blocks the ones behind it.
+ *
+ * Events created through make() live in one of two arenas, one per event
+ * queue. New events are always placed in the arena paired with the pending
+ * queue, once the active queue is completely drained its arena is rewound
+ * (blocks are kept for reuse) right before the queues are switched. Since
+ * arenas only live for a frame, arena events can't be scheduled, the ones
+ * timestamped in the future are dropped with a warning.
+ *
+ * Event types with a coalescer keep at most one pending event per coalescing
+ * key, the older event is released right away and the newer one is queued at
+ * its own position (so it never overtakes events queued in between). Every
+ * queue has a coalescing table indexed by (type, key), queued entries of
+ * coalescable events refer to their event through a table slot. The key moves
+ * to a fresh slot and the older entry is left behind with an empty one, it is
+ * skipped once it comes up, so coalescing never searches the queue. Only the
+ * pending queue is coalesced, a table is cleared once its queue has been
+ * worked off.
+ *
+ * With a budget set, execute() stops dispatching once it is used up (at least
+ * one event is always dispatched). The remaining backlog stays in the active
+ * queue and queues are only switched (and the arena rewound) once it has been
+ * worked off, new events keep accumulating in the pending queue meanwhile.
+ *
+ * Statistics are only collected when enabled. Queueing latency is measured
+ * from the event timestamp, or from the time it was queued for events without
+ * one. Listener entries cache the index of their statistics slot, so COW
+ * copies keep reporting into the same slot.
  */
 
 MARSHMALLOW_NAMESPACE_BEGIN
@@ -67,15 +123,477 @@ namespace { /******************************************** Anonymous Namespace */
 
 	static EventManager *s_instance(0);
 
+	struct QueuedEvent
+	{
+		const IEvent *event;
+		MMTIME timestamp;
+		MMTIME queued;
+		uint32_t sequence;
+		uint32_t slot;
+		uint8_t priority;
+	};
+#define NO_SLOT static_cast<uint32_t>(-1)
+
+	/* heap order: lhs runs after rhs */
 	static bool
-	SortEvent(const IEvent *lhs, const IEvent *rhs) {
-		return(lhs->priority() > rhs->priority()
-		   || lhs->timeStamp() < rhs->timeStamp());
+	RunsAfter(const QueuedEvent &lhs, const QueuedEvent &rhs) {
+		if (lhs.priority != rhs.priority)
+			return(lhs.priority < rhs.priority);
+		if (lhs.timestamp > rhs.timestamp)
+			return(true);
+		if (lhs.timestamp < rhs.timestamp)
+			return(false);
+		return(lhs.sequence > rhs.sequence);
 	}
 
-	typedef std::list<const IEvent *> EventList;
-	typedef std::list<IEventListener *> EventListenerList;
-	typedef std::map<MMUID, EventListenerList *> EventListenerMap;
+	/* heap order: lhs is due after rhs */
+	static bool
+	DueAfter(const QueuedEvent &lhs, const QueuedEvent &rhs) {
+		if (lhs.timestamp > rhs.timestamp)
+			return(true);
+		if (lhs.timestamp < rhs.timestamp)
+			return(false);
+		return(RunsAfter(lhs, rhs));
+	}
+
+	struct EventNode
+	{
+		const IEvent *event;
+		EventNode *next;
+	};
+
+	/* wrap-around safe position arithmetic */
+	inline int32_t
+	PositionNext(int32_t pos)
+	    { return(static_cast<int32_t>(static_cast<uint32_t>(pos) + 1)); }
+
+	inline int32_t
+	PositionDistance(int32_t a, int32_t b)
+	    { return(static_cast<int32_t>
+	          (static_cast<uint32_t>(a) - static_cast<uint32_t>(b))); }
+
+	/*
+	 * Bounded multiple producer, single consumer ring (after Dmitry
+	 * Vyukov's bounded queue). Every cell carries a sequence number that
+	 * tells whose turn it is, producers only contend on the write
+	 * position.
+	 */
+#define POST_RING_SIZE 4096
+	class PostRing
+	{
+		NO_ASSIGN_COPY(PostRing);
+
+		struct Cell
+		{
+			volatile int32_t sequence;
+			const IEvent *event;
+		};
+
+		Cell *m_cells;
+		int32_t m_mask;
+		volatile int32_t m_write;
+		int32_t m_read;
+
+	public:
+
+		PostRing(void)
+		    : m_cells(0)
+		    , m_mask(0)
+		    , m_write(0)
+		    , m_read(0)
+		{}
+
+		~PostRing(void)
+		    { delete[] m_cells; }
+
+		/* capacity must be a power of two */
+		void
+		allocate(int32_t capacity)
+		{
+			m_cells = new Cell[capacity];
+			m_mask = capacity - 1;
+			for (int32_t i = 0; i < capacity; ++i) {
+				m_cells[i].sequence = i;
+				m_cells[i].event = 0;
+			}
+		}
+
+		/* any thread, returns false if full */
+		bool
+		push(const IEvent *event)
+		{
+			for (;;) {
+				const int32_t l_pos = Core::Atomic::Load(&m_write);
+				Cell &l_cell = m_cells[l_pos & m_mask];
+				const int32_t l_diff = PositionDistance
+				    (Core::Atomic::Load(&l_cell.sequence), l_pos);
+
+				if (l_diff < 0)
+					return(false);
+
+				if (0 == l_diff && Core::Atomic::CompareAndSwap
+				    (&m_write, l_pos, PositionNext(l_pos))) {
+					l_cell.event = event;
+					Core::Atomic::Add(&l_cell.sequence, 1);
+					return(true);
+				}
+			}
+		}
+
+		/* consumer only, returns false if empty */
+		bool
+		pop(const IEvent *&event)
+		{
+			Cell &l_cell = m_cells[m_read & m_mask];
+			const int32_t l_next = PositionNext(m_read);
+
+			if (0 != PositionDistance
+			    (Core::Atomic::Load(&l_cell.sequence), l_next))
+				return(false);
+
+			event = l_cell.event;
+			Core::Atomic::Add(&l_cell.sequence, m_mask);
+			m_read = l_next;
+			return(true);
+		}
+
+		/* consumer only, false while a claimed cell is unpublished */
+		bool
+		empty(void) const
+		    { return(m_read == Core::Atomic::Load(&m_write)); }
+	};
+
+	/*
+	 * Bump allocator, memory is only reclaimed on reset().
+	 */
+	class EventArena
+	{
+		NO_ASSIGN_COPY(EventArena);
+
+		struct Block
+		{
+			char  *data;
+			size_t size;
+		};
+		typedef std::vector<Block> BlockList;
+
+		BlockList m_blocks;
+		size_t m_current;
+		size_t m_offset;
+
+	public:
+
+		EventArena(void)
+		    : m_current(0)
+		    , m_offset(0)
+		{}
+
+		~EventArena(void)
+		{
+			for (size_t i = 0; i < m_blocks.size(); ++i)
+				free(m_blocks[i].data);
+		}
+
+		void *
+		allocate(size_t size)
+		{
+#define ARENA_ALIGNMENT (sizeof(void *) * 2)
+#define ARENA_BLOCK_SIZE 16384
+			size = (size + ARENA_ALIGNMENT - 1) & ~(ARENA_ALIGNMENT - 1);
+
+			/* look for room in the current or recycled blocks */
+			while (m_current < m_blocks.size()) {
+				Block &l_block = m_blocks[m_current];
+				if (m_offset + size <= l_block.size) {
+					void *l_ptr = l_block.data + m_offset;
+					m_offset += size;
+					return(l_ptr);
+				}
+				++m_current, m_offset = 0;
+			}
+
+			Block l_block;
+			l_block.size = MMMAX(size, static_cast<size_t>(ARENA_BLOCK_SIZE));
+			l_block.data = static_cast<char *>(malloc(l_block.size));
+			if (!l_block.data)
+				MMFATAL("Event arena allocation failed!");
+			m_blocks.push_back(l_block);
+
+			m_current = m_blocks.size() - 1;
+			m_offset = size;
+			return(l_block.data);
+		}
+
+		bool
+		owns(const void *ptr) const
+		{
+			const char *l_ptr = static_cast<const char *>(ptr);
+			for (size_t i = 0; i < m_blocks.size(); ++i) {
+				const Block &l_block = m_blocks[i];
+				if (l_ptr >= l_block.data
+				    && l_ptr < l_block.data + l_block.size)
+					return(true);
+			}
+			return(false);
+		}
+
+		void
+		reset(void)
+		{
+			m_current = 0;
+			m_offset = 0;
+		}
+	};
+
+	typedef std::vector<QueuedEvent> EventHeap;
+
+	struct CoalescePolicy
+	{
+		MMUID type;
+		EventManager::Coalescer coalescer;
+	};
+	typedef std::vector<CoalescePolicy> CoalescePolicyList;
+
+	/*
+	 * Pending coalesced events of a queue, slots are stable (queued entries
+	 * refer to them) and found by (type, key) through an open-addressing
+	 * index. A slot holding no event is left behind by a dequeued or a
+	 * superseded event.
+	 */
+	class CoalesceTable
+	{
+		NO_ASSIGN_COPY(CoalesceTable);
+
+		struct Bucket
+		{
+			MMUID type;
+			uint32_t key;
+			uint32_t slot;
+		};
+		typedef std::vector<Bucket> BucketList;
+		typedef std::vector<const IEvent *> EventSlotList;
+
+		BucketList m_buckets;
+		EventSlotList m_events;
+		size_t m_used;
+
+		size_t
+		probe(const BucketList &buckets, MMUID type, uint32_t key) const
+		{
+			/* capacity is always a power of two */
+			const size_t l_mask = buckets.size() - 1;
+			size_t l_i = ((type ^ key) * 2654435761u) & l_mask;
+			while (NO_SLOT != buckets[l_i].slot
+			    && (buckets[l_i].type != type || buckets[l_i].key != key))
+				l_i = (l_i + 1) & l_mask;
+			return(l_i);
+		}
+
+		void
+		grow(void)
+		{
+#define COALESCE_TABLE_MIN 32
+			BucketList l_buckets(MMMAX(m_buckets.size() * 2,
+			    static_cast<size_t>(COALESCE_TABLE_MIN)));
+			for (size_t i = 0; i < l_buckets.size(); ++i)
+				l_buckets[i].slot = NO_SLOT;
+
+			for (size_t i = 0; i < m_buckets.size(); ++i) {
+				const Bucket &l_bucket = m_buckets[i];
+				if (NO_SLOT != l_bucket.slot)
+					l_buckets[probe(l_buckets, l_bucket.type,
+					    l_bucket.key)] = l_bucket;
+			}
+
+			m_buckets.swap(l_buckets);
+		}
+
+	public:
+
+		CoalesceTable(void)
+		    : m_used(0)
+		{}
+
+		const IEvent *&
+		event(uint32_t slot)
+		    { return(m_events[slot]); }
+
+		/* slot of (type, key), created empty if missing */
+		uint32_t
+		acquire(MMUID type, uint32_t key)
+		{
+			if ((m_used + 1) * 2 > m_buckets.size())
+				grow();
+
+			Bucket &l_bucket = m_buckets[probe(m_buckets, type, key)];
+			if (NO_SLOT == l_bucket.slot) {
+				l_bucket.type = type;
+				l_bucket.key = key;
+				l_bucket.slot = static_cast<uint32_t>(m_events.size());
+				m_events.push_back(0);
+				++m_used;
+			}
+			return(l_bucket.slot);
+		}
+
+		/* move (type, key) to a new slot, the old one stays behind */
+		uint32_t
+		renew(MMUID type, uint32_t key)
+		{
+			Bucket &l_bucket = m_buckets[probe(m_buckets, type, key)];
+			l_bucket.slot = static_cast<uint32_t>(m_events.size());
+			m_events.push_back(0);
+			return(l_bucket.slot);
+		}
+
+		/* drop index only, queued entries keep their slots */
+		void
+		forget(void)
+		{
+			if (!m_used)
+				return;
+			for (size_t i = 0; i < m_buckets.size(); ++i)
+				m_buckets[i].slot = NO_SLOT;
+			m_used = 0;
+		}
+
+		void
+		clear(void)
+		{
+			forget();
+			m_events.clear();
+		}
+	};
+
+	inline const IEvent *
+	QueuedEventOf(const QueuedEvent &entry, CoalesceTable &table)
+	{
+		return(NO_SLOT == entry.slot ?
+		    entry.event : table.event(entry.slot));
+	}
+	/*
+	 * Listeners are stored as a callback plus a copy of its binding data,
+	 * plain IEventListener handlers get routed through InvokeListener().
+	 */
+#define NO_STATS static_cast<size_t>(-1)
+	struct EventListener
+	{
+		EventManager::EventCallback callback;
+		size_t size;
+		size_t stats;
+		uint32_t key;
+		bool keyed;
+		union {
+			IEventListener *handler;
+			char data[EventManager::BindingSize];
+		} binding;
+	};
+	typedef std::vector<EventListener> EventListenerList;
+
+	inline bool
+	operator==(const EventListener &a, const EventListener &b)
+	{
+		return(a.callback == b.callback && a.size == b.size
+		    && a.keyed == b.keyed && a.key == b.key
+		    && 0 == memcmp(a.binding.data, b.binding.data, a.size));
+	}
+
+	bool
+	InvokeListener(const void *binding, const IEvent &event)
+	{
+		IEventListener * const *l_handler =
+		    static_cast<IEventListener * const *>(binding);
+		return((*l_handler)->handleEvent(event));
+	}
+
+	inline EventListener
+	MakeListener(EventManager::EventCallback callback, const void *binding,
+	    size_t size)
+	{
+		EventListener l_listener;
+		l_listener.callback = callback;
+		l_listener.size = size;
+		l_listener.stats = NO_STATS;
+		l_listener.key = 0;
+		l_listener.keyed = false;
+		memset(l_listener.binding.data, 0, sizeof(l_listener.binding));
+		memcpy(l_listener.binding.data, binding, size);
+		return(l_listener);
+	}
+
+	struct EventListenerArray
+	{
+		EventListenerList listeners;
+		EventListenerList keyed;
+		EventManager::KeyFunction keyer;
+		int refs;
+	};
+
+	struct KeyOrder
+	{
+		bool operator()(const EventListener &lhs, uint32_t rhs) const
+		    { return(lhs.key < rhs); }
+		bool operator()(uint32_t lhs, const EventListener &rhs) const
+		    { return(lhs < rhs.key); }
+		bool operator()(const EventListener &lhs,
+		                const EventListener &rhs) const
+		    { return(lhs.key < rhs.key); }
+	};
+
+	struct EventDispatch
+	{
+		MMUID type;
+		EventListenerArray *array;
+	};
+	typedef std::vector<EventDispatch> EventDispatchList;
+
+	/*
+	 * Event types are never removed, a type without listeners keeps an
+	 * empty array.
+	 */
+	class EventListenerTable
+	{
+		NO_ASSIGN_COPY(EventListenerTable);
+
+		typedef Core::HashTable<MMUID, EventListenerArray *> ArrayTable;
+		ArrayTable m_table;
+
+	public:
+
+		EventListenerTable(void)
+		{}
+
+		EventListenerArray *
+		find(MMUID type) const
+		{
+			EventListenerArray * const *l_array = m_table.find(type);
+			return(l_array ? *l_array : 0);
+		}
+
+		/* returns array slot, inserting an empty array if needed */
+		EventListenerArray *&
+		insert(MMUID type)
+		{
+			EventListenerArray *&l_array = m_table.insert(type);
+			if (!l_array) {
+				l_array = new EventListenerArray;
+				l_array->keyer = 0;
+				l_array->refs = 1;
+			}
+			return(l_array);
+		}
+
+		size_t
+		capacity(void) const
+		    { return(m_table.capacity()); }
+
+		EventListenerArray *
+		at(size_t index)
+		{
+			EventListenerArray **l_array = m_table.at(index);
+			return(l_array ? *l_array : 0);
+		}
+	};
 
 } /****************************************************** Anonymous Namespace */
 
@@ -83,109 +601,209 @@ namespace Event { /****************************************** Event Namespace */
 
 struct EventManager::Private
 {
-	Private(const Core::Identifier &i)
-	    : id(i)
-	    , dispatch_type(Core::Type::Null)
+	Private(const Core::Identifier &i, QueueMode m)
+	    : posted(0)
+	    , recorder(0)
+	    , filter(0)
+	    , id(i)
+	    , mode(m)
+	    , sequence(0)
+	    , budget_time(0)
+	    , budget_count(0)
+	    , backlog(0)
+	    , queue_peak(0)
+	    , schedule_peak(0)
+	    , type_stats_last(0)
 	    , active_queue(0)
-	    , dispatch_invalid(true)
-	{}
+	    , stats_enabled(false)
+	{
+		if (ConcurrentQueue == mode)
+			post_ring.allocate(POST_RING_SIZE);
+	}
 
 	~Private();
 
-	inline bool connect(IEventListener *handler, const Core::Type &type);
-	inline bool disconnect(IEventListener *handler, const Core::Type &type);
+	inline bool connect(const EventListener &listener, const Core::Type &type);
+	inline bool disconnect(const EventListener &listener, const Core::Type &type);
 
 	inline bool queue(const IEvent *event);
 	inline bool dequeue(const IEvent *event, bool all = false);
 
+	inline bool setKeyFunction(const Core::Type &type, KeyFunction keyer);
+
 	inline bool dispatch(const IEvent &event);
 
+	inline bool invoke(EventListener *begin, EventListener *end,
+	    const IEvent &event);
+
 	inline bool execute(void);
 
-	EventListenerMap listener_map;
+	inline void drain(void);
+
+	inline bool push(const IEvent *event);
+
+	inline void coalesce(QueuedEvent &entry);
+
+	inline bool remove(EventHeap &heap, const IEvent *event, MMUID type,
+	    bool (*order)(const QueuedEvent &, const QueuedEvent &),
+	    CoalesceTable *table);
+
+	inline void release(const IEvent *event);
+
+	static inline void unref(EventListenerArray *array);
+
+	static inline EventListenerArray * writable(EventListenerArray *&array);
+
+	inline TypeStats & typeStats(const Core::Type &type);
+	inline ListenerStats & listenerStats(EventListener &listener,
+	    const Core::Type &type);
+
+	inline bool owns(const IEvent *event) const
+	    { return(event_arena[0].owns(event) || event_arena[1].owns(event)); }
+
+	EventListenerTable listener_table;
+	EventDispatchList dispatching;
 #define QUEUE_MAX 2
-	EventList event_queue[QUEUE_MAX];
+	EventHeap event_queue[QUEUE_MAX];
+	EventArena event_arena[QUEUE_MAX];
+	EventHeap schedule;
+	CoalescePolicyList policies;
+	CoalesceTable coalesce_table[QUEUE_MAX];
+	PostRing post_ring;
+	EventNode * volatile posted;
+	IEventListener *recorder;
+	IEventListener *filter;
 	Core::Identifier id;
-	Core::Type dispatch_type;
+	QueueMode mode;
+	uint32_t sequence;
+	MMTIME budget_time;
+	size_t budget_count;
+	size_t backlog;
+	std::vector<TypeStats> type_stats;
+	std::vector<ListenerStats> listener_stats;
+	size_t queue_peak;
+	size_t schedule_peak;
+	size_t type_stats_last;
 	uint8_t active_queue;
-	bool dispatch_invalid;
+	bool stats_enabled;
 };
 
 EventManager::Private::~Private()
 {
-	/* free listener maps */
-	EventListenerMap::iterator l_elm_i;
-	const EventListenerMap::const_iterator l_elm_c = listener_map.end();
-	for (l_elm_i = listener_map.begin(); l_elm_i != l_elm_c; ++l_elm_i)
-		delete l_elm_i->second;
-	listener_map.clear();
+	/* free listener arrays */
+	for (size_t i = 0; i < listener_table.capacity(); ++i)
+		if (listener_table.at(i))
+			unref(listener_table.at(i));
+
+	/* collect posted events */
+	drain();
 
 	/* flush event queues */
 	for (int i = 0; i < QUEUE_MAX; ++i) {
-		EventList &l_queue = event_queue[i];
-		while (!l_queue.empty()) {
-			delete l_queue.front();
-			l_queue.pop_front();
+		EventHeap &l_queue = event_queue[i];
+		for (size_t j = 0; j < l_queue.size(); ++j) {
+			const IEvent *l_event =
+			    QueuedEventOf(l_queue[j], coalesce_table[i]);
+			if (l_event) release(l_event);
 		}
+		l_queue.clear();
 	}
+
+	/* flush scheduled events */
+	for (size_t j = 0; j < schedule.size(); ++j)
+		release(schedule[j].event);
+	schedule.clear();
 }
 
 bool
-EventManager::Private::connect(IEventListener *handler, const Core::Type &t)
+EventManager::Private::connect(const EventListener &listener, const Core::Type &t)
 {
-	MMINFO("Connecting `" << &handler
+	MMINFO("Connecting `" << listener.binding.handler
 	                      << "` handler to event type `"
 	                      << t.str()
 	                      << "`.");
 
-	EventListenerMap::const_iterator l_listener_mapi =
-	    listener_map.find(t.uid());
-
-	/* if this is a new type, assign a new EventListenerList */
-	if (l_listener_mapi == listener_map.end())
-		listener_map[t.uid()] = new EventListenerList;
-
-	EventListenerList *l_listeners(listener_map[t.uid()]);
+	EventListenerArray *&l_array = listener_table.insert(t.uid());
 
-	EventListenerList::const_iterator l_listenersi =
-	    std::find(l_listeners->begin(), l_listeners->end(), handler);
+	if (listener.keyed && !l_array->keyer) {
+		MMWARNING("Failed! Event type has no key function.");
+		return(false);
+	}
 
-	if (l_listenersi == l_listeners->end())
-		l_listeners->push_back(handler);
-	else {
+	const EventListenerList &l_current =
+	    listener.keyed ? l_array->keyed : l_array->listeners;
+	if (std::find(l_current.begin(), l_current.end(), listener)
+	    != l_current.end()) {
 		MMWARNING("Failed! Listener already connected to this event type.");
 		return(false);
 	}
 
-	MMINFO("Connected! Current listener count is: " << l_listeners->size() << ".");
+	EventListenerList &l_listeners = listener.keyed
+	    ? writable(l_array)->keyed : writable(l_array)->listeners;
 
-	/* invalidate dispatch if needed */
-	dispatch_invalid |= (dispatch_type == t);
+	/* keyed listeners are sorted by key, then connection order */
+	if (listener.keyed)
+		l_listeners.insert(std::upper_bound(l_listeners.begin(),
+		    l_listeners.end(), listener.key, KeyOrder()), listener);
+	else l_listeners.push_back(listener);
+
+	MMINFO("Connected! Current listener count is: " << l_listeners.size() << ".");
 
 	return(true);
 }
 
 bool
-EventManager::Private::disconnect(IEventListener *handler, const Core::Type &t)
+EventManager::Private::disconnect(const EventListener &listener, const Core::Type &t)
 {
-	MMINFO("Disconnecting `" << &handler << "` handler from event type `" << t.str() << "`");
-
-	EventListenerMap::const_iterator l_listener_mapi =
-	    listener_map.find(t.uid());
+	MMINFO("Disconnecting `" << listener.binding.handler << "` handler from event type `" << t.str() << "`");
 
-	/* if this is a new type, assign a new EventListenerList */
-	if (l_listener_mapi == listener_map.end()) {
+	if (!listener_table.find(t.uid())) {
 		MMWARNING("Failed! Event type not in registry.");
 		return(false);
 	}
 
-	EventListenerList *l_listeners(listener_map[t.uid()]);
-	l_listeners->remove(handler);
-	MMINFO("Disconnected! Current listener count is: " << l_listeners->size() << ".");
+	EventListenerArray *&l_array = listener_table.insert(t.uid());
+
+	const EventListenerList &l_current =
+	    listener.keyed ? l_array->keyed : l_array->listeners;
+	if (std::find(l_current.begin(), l_current.end(), listener)
+	    == l_current.end())
+		return(true);
+
+	EventListenerList &l_listeners = listener.keyed
+	    ? writable(l_array)->keyed : writable(l_array)->listeners;
+	l_listeners.erase(std::find(l_listeners.begin(), l_listeners.end(),
+	    listener));
+
+	/* make sure active dispatches skip it */
+	for (size_t i = 0; i < dispatching.size(); ++i) {
+		if (dispatching[i].type != t.uid())
+			continue;
+
+		EventListenerList &l_active = listener.keyed
+		    ? dispatching[i].array->keyed
+		    : dispatching[i].array->listeners;
+		for (size_t j = 0; j < l_active.size(); ++j)
+			if (l_active[j] == listener)
+				l_active[j].callback = 0;
+	}
+
+	MMINFO("Disconnected! Current listener count is: " << l_listeners.size() << ".");
+
+	return(true);
+}
+
+bool
+EventManager::Private::setKeyFunction(const Core::Type &t, KeyFunction keyer)
+{
+	EventListenerArray *&l_array = listener_table.insert(t.uid());
 
-	/* invalidate dispatch if needed */
-	dispatch_invalid |= (dispatch_type == t);
+	if (!keyer && !l_array->keyed.empty()) {
+		MMWARNING("Failed! Event type has keyed listeners.");
+		return(false);
+	}
 
+	writable(l_array)->keyer = keyer;
 	return(true);
 }
 
@@ -194,30 +812,85 @@ EventManager::Private::dispatch(const IEvent &event)
 {
 	bool l_handled = false;
 
-	EventListenerMap::const_iterator l_listener_mapi =
-	    listener_map.find(event.type().uid());
-	if (l_listener_mapi == listener_map.end())
+	if (filter && filter->handleEvent(event))
 		return(false);
 
-	dispatch_invalid = false;
-	dispatch_type = event.type();
+	if (recorder)
+		recorder->handleEvent(event);
 
-	EventListenerList *l_listeners(l_listener_mapi->second);
-	EventListenerList::iterator l_listenersi;
+	if (stats_enabled)
+		++typeStats(event.type()).dispatched;
 
-	for (l_listenersi = l_listeners->begin();
-	     !l_handled && !dispatch_invalid
-	       && (l_listenersi != l_listeners->end());) {
-		if (*l_listenersi)
-			l_handled = (*l_listenersi++)->handleEvent(event);
-		else
-			l_listeners->erase(l_listenersi++);
+	EventListenerArray *l_array = listener_table.find(event.type().uid());
+	if (!l_array)
+		return(false);
+
+	/* hold array, (dis)connecting listeners will copy it */
+	++l_array->refs;
+
+	EventDispatch l_dispatch;
+	l_dispatch.type = event.type().uid();
+	l_dispatch.array = l_array;
+	dispatching.push_back(l_dispatch);
+
+	/* listeners subscribed to the event's key go first */
+	uint32_t l_key;
+	EventListenerList &l_keyed = l_array->keyed;
+	if (!l_keyed.empty() && l_array->keyer(event, l_key)) {
+		std::pair<EventListenerList::iterator,
+		          EventListenerList::iterator> l_range =
+		    std::equal_range(l_keyed.begin(), l_keyed.end(), l_key,
+		        KeyOrder());
+		if (l_range.first != l_range.second)
+			l_handled = invoke(&*l_range.first,
+			    &*l_range.first + (l_range.second - l_range.first),
+			    event);
 	}
 
-	if (dispatch_invalid && !l_handled)
-		MMERROR("Dispatch listeners changed without current event being handled.");
+	EventListenerList &l_listeners = l_array->listeners;
+	if (!l_handled && !l_listeners.empty())
+		l_handled = invoke(&l_listeners[0],
+		    &l_listeners[0] + l_listeners.size(), event);
+
+	dispatching.pop_back();
+	unref(l_array);
+
+	/* type stats may have moved too */
+	if (l_handled && stats_enabled)
+		++typeStats(event.type()).handled;
+
+	return(l_handled);
+}
+
+bool
+EventManager::Private::invoke(EventListener *begin, EventListener *end,
+    const IEvent &event)
+{
+	bool l_handled = false;
 
-	dispatch_type = Core::Type::Null;
+	for (EventListener *l_i = begin; !l_handled && l_i != end; ++l_i) {
+		EventListener &l_listener = *l_i;
+		if (!l_listener.callback)
+			continue;
+
+		if (!stats_enabled) {
+			l_handled = l_listener.callback(l_listener.binding.data, event);
+			continue;
+		}
+
+		/* time listener, stats may move while it runs */
+		listenerStats(l_listener, event.type());
+		const size_t l_slot = l_listener.stats;
+		const MMTIME l_start = NOW();
+		l_handled = l_listener.callback(l_listener.binding.data, event);
+		const MMTIME l_time = NOW() - l_start;
+
+		ListenerStats &l_listener_stats = listener_stats[l_slot];
+		++l_listener_stats.calls;
+		l_listener_stats.time += l_time;
+		l_listener_stats.time_max =
+		    MMMAX(l_listener_stats.time_max, l_time);
+	}
 
 	return(l_handled);
 }
@@ -225,65 +898,344 @@ EventManager::Private::dispatch(const IEvent &event)
 bool
 EventManager::Private::queue(const IEvent *event)
 {
-	EventList &l_queue = event_queue[active_queue == 0 ? 1 : 0];
-	l_queue.push_back(event);
-	return(true);
+	if (ConcurrentQueue == mode) {
+		/* stick to the overflow stack until it gets drained */
+		if (!posted && post_ring.push(event))
+			return(true);
+
+		EventNode *l_node = new EventNode;
+		l_node->event = event;
+
+		do l_node->next = posted;
+		while (!Core::Atomic::CompareAndSwap(&posted, l_node->next, l_node));
+
+		return(true);
+	}
+
+	return(push(event));
 }
 
 bool
 EventManager::Private::dequeue(const IEvent *event, bool all)
 {
-	EventList &l_queue = event_queue[active_queue == 0 ? 1 : 0];
+	drain();
 
-	if (all) {
-		const MMUID l_type = event->type();
-		EventList::reverse_iterator l_i = l_queue.rbegin();
+	/* match by type (all) or by address */
+	const MMUID l_type = all ? event->type().uid() : 0;
+	const IEvent *l_event = all ? 0 : event;
 
-		while (l_i != l_queue.rend()) {
-			if (l_type == (*l_i)->type()) {
-			    EventList::iterator l_tmp = l_queue.erase(--l_i.base());
-			    l_i = EventList::reverse_iterator(l_tmp);
-			}
-			else ++l_i;
+	const int l_pending = active_queue == 0 ? 1 : 0;
+	bool l_found = remove(event_queue[l_pending], l_event, l_type,
+	                      RunsAfter, &coalesce_table[l_pending]);
+	l_found |= remove(event_queue[active_queue], l_event, l_type,
+	                  RunsAfter, &coalesce_table[active_queue]);
+	l_found |= remove(schedule, l_event, l_type, DueAfter, 0);
+
+	return(l_found);
+}
+
+bool
+EventManager::Private::execute()
+{
+	EventHeap &l_queue = event_queue[active_queue];
+
+	/* move due scheduled events into the active queue */
+	const MMTIME l_now = NOW();
+	while (!schedule.empty() && schedule.front().timestamp <= l_now) {
+		std::pop_heap(schedule.begin(), schedule.end(), DueAfter);
+		l_queue.push_back(schedule.back());
+		std::push_heap(l_queue.begin(), l_queue.end(), RunsAfter);
+		schedule.pop_back();
+	}
+
+	/* dispatch events in active queue, highest priority first */
+	const MMTIME l_deadline = budget_time > 0 ? l_now + budget_time : 0;
+	size_t l_count = 0;
+	while (!l_queue.empty()) {
+		/* superseded by a newer coalesced event */
+		if (!QueuedEventOf(l_queue.front(), coalesce_table[active_queue])) {
+			std::pop_heap(l_queue.begin(), l_queue.end(), RunsAfter);
+			l_queue.pop_back();
+			continue;
+		}
+
+		/* out of budget, leave the rest for the next frame */
+		if ((budget_count && l_count == budget_count)
+		    || (l_deadline > 0 && l_count && NOW() >= l_deadline))
+			break;
+		++l_count;
+
+		std::pop_heap(l_queue.begin(), l_queue.end(), RunsAfter);
+		const IEvent *l_event =
+		    QueuedEventOf(l_queue.back(), coalesce_table[active_queue]);
+
+		if (stats_enabled) {
+			const QueuedEvent &l_entry = l_queue.back();
+			const MMTIME l_latency = NOW() -
+			    (l_entry.timestamp > 0 ? l_entry.timestamp : l_entry.queued);
+
+			TypeStats &l_stats = typeStats(l_event->type());
+			l_stats.latency += l_latency;
+			l_stats.latency_max = MMMAX(l_stats.latency_max, l_latency);
 		}
-	} else {
-		l_queue.remove(event);
+
+		l_queue.pop_back();
+
+		dispatch(*l_event);
+		release(l_event);
 	}
 
+	/* collect events posted by other threads */
+	drain();
+
+	/* keep working on the backlog before switching queues */
+	backlog = l_queue.size();
+	if (backlog > 0)
+		return(false);
+
+	/* recycle arena and coalescing table, all of its events are gone */
+	event_arena[active_queue].reset();
+	coalesce_table[active_queue].clear();
+
+	/* switch active queues */
+	active_queue = (active_queue == 0 ? 1 : 0);
 	return(true);
 }
 
-bool
-EventManager::Private::execute()
+void
+EventManager::Private::drain(void)
 {
-	/* fetch and sort active queue */
-	EventList &l_queue = event_queue[active_queue];
-	l_queue.sort(SortEvent);
+	if (ConcurrentQueue != mode)
+		return;
 
-	/* dispatch events in active queue
-	 *
-	 * stop only if:
-	 *     we ran out of messages
-	 *     event timestamp is in the future
-	 */
 	const IEvent *l_event;
-	while (!l_queue.empty()
-	    && (l_event = l_queue.front())->timeStamp() <= NOW()) {
-		dispatch(*l_event);
-		l_queue.pop_front();
-		delete l_event;
+	while (post_ring.pop(l_event))
+		push(l_event);
+
+	/*
+	 * A producer may still be filling a cell it claimed, overflow events
+	 * are newer than anything in the ring so they have to wait.
+	 */
+	if (!post_ring.empty())
+		return;
+
+	EventNode *l_node =
+	    Core::Atomic::Exchange(&posted, static_cast<EventNode *>(0));
+	if (!l_node)
+		return;
+
+	/* stack is newest first, restore posting order */
+	EventNode *l_ordered = 0;
+	while (l_node) {
+		EventNode *l_next = l_node->next;
+		l_node->next = l_ordered;
+		l_ordered = l_node;
+		l_node = l_next;
 	}
 
-	if (l_queue.empty()) {
-		/* switch active queues */
-		active_queue = (active_queue == 0 ? 1 : 0);
+	while (l_ordered) {
+		EventNode *l_next = l_ordered->next;
+		push(l_ordered->event);
+		delete l_ordered;
+		l_ordered = l_next;
+	}
+}
+
+bool
+EventManager::Private::push(const IEvent *event)
+{
+	if (filter && filter->handleEvent(*event)) {
+		release(event);
+		return(false);
+	}
+
+	const bool l_future = event->timeStamp() > NOW();
+
+	/* arena events can't outlive the frame */
+	if (l_future && owns(event)) {
+		MMWARNING("Failed! Arena events can't be scheduled, dropped.");
+		event->~IEvent();
+		return(false);
+	}
+
+	QueuedEvent l_entry;
+	l_entry.event = event;
+	l_entry.timestamp = event->timeStamp();
+	l_entry.priority = event->priority();
+	l_entry.sequence = sequence++;
+	l_entry.slot = NO_SLOT;
+	l_entry.queued = 0;
+
+	if (stats_enabled) {
+		l_entry.queued = NOW();
+		++typeStats(event->type()).queued;
+	}
+
+	/* future events wait in the schedule */
+	if (l_future) {
+		schedule.push_back(l_entry);
+		std::push_heap(schedule.begin(), schedule.end(), DueAfter);
+		schedule_peak = MMMAX(schedule_peak, schedule.size());
 		return(true);
 	}
-	return(false);
+
+	EventHeap &l_queue = event_queue[active_queue == 0 ? 1 : 0];
+	if (!policies.empty())
+		coalesce(l_entry);
+
+	l_queue.push_back(l_entry);
+	std::push_heap(l_queue.begin(), l_queue.end(), RunsAfter);
+	queue_peak = MMMAX(queue_peak, l_queue.size());
+	return(true);
+}
+
+void
+EventManager::Private::coalesce(QueuedEvent &entry)
+{
+	const IEvent *l_event = entry.event;
+	const MMUID l_type = l_event->type().uid();
+
+	size_t l_policy = 0;
+	while (l_policy < policies.size() && policies[l_policy].type != l_type)
+		++l_policy;
+	if (l_policy == policies.size())
+		return;
+
+	uint32_t l_key;
+	if (!policies[l_policy].coalescer(*l_event, l_key))
+		return;
+
+	CoalesceTable &l_table = coalesce_table[active_queue == 0 ? 1 : 0];
+	uint32_t l_slot = l_table.acquire(l_type, l_key);
+
+	/* drop older event, its queued entry gets skipped */
+	const IEvent *l_pending = l_table.event(l_slot);
+	if (l_pending) {
+		if (stats_enabled)
+			++typeStats(l_pending->type()).coalesced;
+
+		release(l_pending);
+		l_table.event(l_slot) = 0;
+		l_slot = l_table.renew(l_type, l_key);
+	}
+
+	/* newer event is queued at its own position */
+	l_table.event(l_slot) = l_event;
+	entry.slot = l_slot;
+}
+
+bool
+EventManager::Private::remove(EventHeap &heap, const IEvent *event, MMUID t,
+    bool (*order)(const QueuedEvent &, const QueuedEvent &),
+    CoalesceTable *table)
+{
+	size_t l_kept = 0;
+	bool l_found = false;
+
+	for (size_t i = 0; i < heap.size(); ++i) {
+		const QueuedEvent &l_entry = heap[i];
+		const IEvent *l_event =
+		    table ? QueuedEventOf(l_entry, *table) : l_entry.event;
+
+		/* superseded entries go too */
+		if (!l_event)
+			continue;
+
+		if (event ? l_event == event : t == l_event->type().uid()) {
+			if (owns(l_event)) l_event->~IEvent();
+
+			/* free coalescing slot for newer events */
+			if (NO_SLOT != l_entry.slot)
+				table->event(l_entry.slot) = 0;
+			l_found = true;
+		} else heap[l_kept++] = heap[i];
+	}
+
+	if (l_kept == heap.size())
+		return(false);
+
+	heap.resize(l_kept);
+	std::make_heap(heap.begin(), heap.end(), order);
+	return(l_found);
 }
 
-EventManager::EventManager(const Core::Identifier &i)
-    : PIMPL_CREATE_X(i)
+void
+EventManager::Private::unref(EventListenerArray *array)
+{
+	if (0 == --array->refs)
+		delete array;
+}
+
+EventListenerArray *
+EventManager::Private::writable(EventListenerArray *&array)
+{
+	/* array is being dispatched, copy on write */
+	if (array->refs > 1) {
+		EventListenerArray *l_copy = new EventListenerArray(*array);
+		l_copy->refs = 1;
+		unref(array);
+		array = l_copy;
+	}
+	return(array);
+}
+
+EventManager::TypeStats &
+EventManager::Private::typeStats(const Core::Type &t)
+{
+	/* events tend to come in runs of the same type */
+	if (type_stats_last < type_stats.size()
+	    && type_stats[type_stats_last].type == t)
+		return(type_stats[type_stats_last]);
+
+	for (size_t i = 0; i < type_stats.size(); ++i)
+		if (type_stats[i].type == t)
+			return(type_stats[type_stats_last = i]);
+
+	TypeStats l_stats;
+	l_stats.type = t;
+	l_stats.queued = l_stats.coalesced = 0;
+	l_stats.dispatched = l_stats.handled = 0;
+	l_stats.latency = l_stats.latency_max = 0;
+	type_stats.push_back(l_stats);
+
+	return(type_stats[type_stats_last = type_stats.size() - 1]);
+}
+
+EventManager::ListenerStats &
+EventManager::Private::listenerStats(EventListener &listener,
+    const Core::Type &t)
+{
+	if (NO_STATS != listener.stats)
+		return(listener_stats[listener.stats]);
+
+	/* reconnected listeners reuse their slot */
+	for (size_t i = 0; i < listener_stats.size(); ++i)
+		if (listener_stats[i].listener == listener.binding.handler
+		    && listener_stats[i].type == t)
+			return(listener_stats[listener.stats = i]);
+
+	ListenerStats l_stats;
+	l_stats.listener = listener.binding.handler;
+	l_stats.type = t;
+	l_stats.calls = 0;
+	l_stats.time = l_stats.time_max = 0;
+	listener_stats.push_back(l_stats);
+
+	listener.stats = listener_stats.size() - 1;
+	return(listener_stats.back());
+}
+
+void
+EventManager::Private::release(const IEvent *event)
+{
+	if (owns(event))
+		event->~IEvent();
+	else
+		delete event;
+}
+
+EventManager::EventManager(const Core::Identifier &i, QueueMode m)
+    : PIMPL_CREATE_X(i, m)
 {
 	if (!s_instance) s_instance = this;
 }
@@ -301,16 +1253,228 @@ EventManager::id(void) const
 	return(PIMPL->id);
 }
 
+EventManager::QueueMode
+EventManager::queueMode(void) const
+{
+	return(PIMPL->mode);
+}
+
 bool
 EventManager::connect(IEventListener *handler, const Core::Type &t)
 {
-	return(PIMPL->connect(handler, t));
+	return(PIMPL->connect(MakeListener(InvokeListener, &handler,
+	    sizeof(handler)), t));
 }
 
 bool
 EventManager::disconnect(IEventListener *handler, const Core::Type &t)
 {
-	return(PIMPL->disconnect(handler, t));
+	return(PIMPL->disconnect(MakeListener(InvokeListener, &handler,
+	    sizeof(handler)), t));
+}
+
+bool
+EventManager::connect(IEventListener *handler, const Core::Type &t,
+    uint32_t key)
+{
+	EventListener l_listener =
+	    MakeListener(InvokeListener, &handler, sizeof(handler));
+	l_listener.key = key;
+	l_listener.keyed = true;
+	return(PIMPL->connect(l_listener, t));
+}
+
+bool
+EventManager::disconnect(IEventListener *handler, const Core::Type &t,
+    uint32_t key)
+{
+	EventListener l_listener =
+	    MakeListener(InvokeListener, &handler, sizeof(handler));
+	l_listener.key = key;
+	l_listener.keyed = true;
+	return(PIMPL->disconnect(l_listener, t));
+}
+
+bool
+EventManager::connect(const Core::Type &t, EventCallback callback,
+    const void *binding, size_t size, uint32_t key)
+{
+	if (size > BindingSize) {
+		MMERROR("Binding too large for event type `" << t.str() << "`.");
+		return(false);
+	}
+
+	EventListener l_listener = MakeListener(callback, binding, size);
+	l_listener.key = key;
+	l_listener.keyed = true;
+	return(PIMPL->connect(l_listener, t));
+}
+
+bool
+EventManager::disconnect(const Core::Type &t, EventCallback callback,
+    const void *binding, size_t size, uint32_t key)
+{
+	if (size > BindingSize)
+		return(false);
+
+	EventListener l_listener = MakeListener(callback, binding, size);
+	l_listener.key = key;
+	l_listener.keyed = true;
+	return(PIMPL->disconnect(l_listener, t));
+}
+
+bool
+EventManager::setKeyFunction(const Core::Type &t, KeyFunction keyer)
+{
+	return(PIMPL->setKeyFunction(t, keyer));
+}
+
+bool
+EventManager::connect(const Core::Type &t, EventCallback callback,
+    const void *binding, size_t size)
+{
+	if (size > BindingSize) {
+		MMERROR("Binding too large for event type `" << t.str() << "`.");
+		return(false);
+	}
+	return(PIMPL->connect(MakeListener(callback, binding, size), t));
+}
+
+bool
+EventManager::disconnect(const Core::Type &t, EventCallback callback,
+    const void *binding, size_t size)
+{
+	if (size > BindingSize)
+		return(false);
+	return(PIMPL->disconnect(MakeListener(callback, binding, size), t));
+}
+
+bool
+EventManager::setCoalescer(const Core::Type &t, Coalescer coalescer)
+{
+	CoalescePolicyList &l_policies = PIMPL->policies;
+	CoalescePolicyList::iterator l_i;
+	for (l_i = l_policies.begin(); l_i != l_policies.end(); ++l_i)
+		if (l_i->type == t.uid())
+			break;
+
+	/* pending events keep their current state */
+	PIMPL->coalesce_table[PIMPL->active_queue == 0 ? 1 : 0].forget();
+
+	if (!coalescer) {
+		if (l_i == l_policies.end())
+			return(false);
+		l_policies.erase(l_i);
+		return(true);
+	}
+
+	if (l_i == l_policies.end()) {
+		CoalescePolicy l_policy;
+		l_policy.type = t.uid();
+		l_policy.coalescer = coalescer;
+		l_policies.push_back(l_policy);
+	}
+	else l_i->coalescer = coalescer;
+
+	return(true);
+}
+
+void
+EventManager::setBudget(MMTIME time, size_t count)
+{
+	PIMPL->budget_time = time;
+	PIMPL->budget_count = count;
+}
+
+MMTIME
+EventManager::budgetTime(void) const
+{
+	return(PIMPL->budget_time);
+}
+
+size_t
+EventManager::budgetCount(void) const
+{
+	return(PIMPL->budget_count);
+}
+
+size_t
+EventManager::backlog(void) const
+{
+	return(PIMPL->backlog);
+}
+
+void
+EventManager::setStatsEnabled(bool e)
+{
+	PIMPL->stats_enabled = e;
+}
+
+bool
+EventManager::isStatsEnabled(void) const
+{
+	return(PIMPL->stats_enabled);
+}
+
+void
+EventManager::setRecorder(IEventListener *r)
+{
+	PIMPL->recorder = r;
+}
+
+IEventListener *
+EventManager::recorder(void) const
+{
+	return(PIMPL->recorder);
+}
+
+void
+EventManager::setFilter(IEventListener *f)
+{
+	PIMPL->filter = f;
+}
+
+IEventListener *
+EventManager::filter(void) const
+{
+	return(PIMPL->filter);
+}
+
+EventManager::Stats
+EventManager::stats(void) const
+{
+	Stats l_stats;
+	l_stats.types = PIMPL->type_stats.empty() ? 0 : &PIMPL->type_stats[0];
+	l_stats.type_count = PIMPL->type_stats.size();
+	l_stats.listeners =
+	    PIMPL->listener_stats.empty() ? 0 : &PIMPL->listener_stats[0];
+	l_stats.listener_count = PIMPL->listener_stats.size();
+	l_stats.queue_depth =
+	    PIMPL->event_queue[PIMPL->active_queue == 0 ? 1 : 0].size();
+	l_stats.queue_peak = PIMPL->queue_peak;
+	l_stats.backlog = PIMPL->backlog;
+	l_stats.schedule_peak = PIMPL->schedule_peak;
+	return(l_stats);
+}
+
+void
+EventManager::resetStats(void)
+{
+	/* slots are kept, listeners cache their index */
+	for (size_t i = 0; i < PIMPL->type_stats.size(); ++i) {
+		TypeStats &l_stats = PIMPL->type_stats[i];
+		l_stats.queued = l_stats.coalesced = 0;
+		l_stats.dispatched = l_stats.handled = 0;
+		l_stats.latency = l_stats.latency_max = 0;
+	}
+
+	for (size_t i = 0; i < PIMPL->listener_stats.size(); ++i) {
+		ListenerStats &l_stats = PIMPL->listener_stats[i];
+		l_stats.calls = 0;
+		l_stats.time = l_stats.time_max = 0;
+	}
+
+	PIMPL->queue_peak = PIMPL->schedule_peak = 0;
 }
 
 bool
@@ -337,6 +1501,13 @@ EventManager::execute()
 	return(PIMPL->execute());
 }
 
+void *
+EventManager::allocate(size_t size)
+{
+	return(PIMPL->event_arena[PIMPL->active_queue == 0 ? 1 : 0]
+	    .allocate(size));
+}
+
 EventManager *
 EventManager::Instance(void)
 {
@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#include "event/eventplayer.h"
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+#include "core/idataio.h"
+#include "core/logger.h"
+#include "core/type.h"
+
+#include "event/eventmanager.h"
+#include "event/ieventlistener.h"
+#include "event/joystickaxisevent.h"
+#include "event/joystickbuttonevent.h"
+#include "event/keyboardevent.h"
+#include "event/sensorevent.h"
+#include "event/touchevent.h"
+
+#include "event/eventrecord_p.h"
+
+#include <cstring>
+#include <vector>
+
+MARSHMALLOW_NAMESPACE_BEGIN
+namespace Event { /****************************************** Event Namespace */
+namespace { /*********************************** Event::<anonymous> Namespace */
+
+	typedef std::vector<EventRecord> EventRecordList;
+
+	inline float
+	BitsFloat(int32_t bits)
+	{
+		float l_value;
+		memcpy(&l_value, &bits, sizeof(l_value));
+		return(l_value);
+	}
+
+	/* replayed event types */
+	const Core::Type & (* const s_types[])(void) = {
+		&KeyboardEvent::Type,
+		&JoystickAxisEvent::Type,
+		&JoystickButtonEvent::Type,
+		&TouchEvent::Type,
+		&SensorEvent::Type
+	};
+	const size_t s_types_count = sizeof(s_types) / sizeof(s_types[0]);
+
+	/* drops live input while a replay is active */
+	struct LiveInputFilter : public IEventListener
+	{
+		LiveInputFilter(void)
+		    : replaying(false)
+		{}
+
+		VIRTUAL bool handleEvent(const IEvent &event)
+		{
+			if (replaying)
+				return(false);
+
+			const MMUID l_type = event.type().uid();
+			for (size_t i = 0; i < s_types_count; ++i)
+				if (l_type == s_types[i]().uid())
+					return(true);
+			return(false);
+		}
+
+		bool replaying;
+	};
+
+} /********************************************* Event::<anonymous> Namespace */
+
+struct EventPlayer::Private
+{
+	Private(EventPlayer &p, EventManager *m)
+	    : player(p)
+	    , manager(m ? m : EventManager::Instance())
+	    , next(0)
+	    , step(0)
+	    , valid(false)
+	{}
+
+	inline bool load(Core::IDataIO *input);
+
+	inline void play(void);
+
+	inline void replay(const EventRecord &record);
+
+	inline void dispatch(const InputEvent &event);
+
+	inline void filter(bool enable);
+
+	EventPlayer &player;
+	EventManager *manager;
+	LiveInputFilter live_filter;
+	EventRecordList records;
+	size_t next;
+	uint32_t step;
+	bool valid;
+};
+
+bool
+EventPlayer::Private::load(Core::IDataIO *input)
+{
+	EventRecordHeader l_header;
+	if (!input || !input->isOpen()
+	    || sizeof(l_header) != input->read(&l_header, sizeof(l_header))) {
+		MMERROR("Unable to read recording header.");
+		return(false);
+	}
+
+	if (EVENT_RECORD_MAGIC != l_header.magic
+	    || EVENT_RECORD_VERSION != l_header.version
+	    || sizeof(EventRecord) != l_header.size) {
+		MMERROR("Incompatible event recording.");
+		return(false);
+	}
+
+	EventRecord l_batch[EVENT_RECORD_BATCH];
+	size_t l_read;
+	do {
+		l_read = input->read(l_batch, sizeof(l_batch)) / sizeof(EventRecord);
+		records.insert(records.end(), l_batch, l_batch + l_read);
+	} while (EVENT_RECORD_BATCH == l_read);
+
+	return(true);
+}
+
+void
+EventPlayer::Private::play(void)
+{
+	while (next < records.size() && records[next].step <= step)
+		replay(records[next++]);
+
+	/* live input is back once everything has been replayed */
+	if (next >= records.size())
+		filter(false);
+}
+
+void
+EventPlayer::Private::dispatch(const InputEvent &event)
+{
+	player.apply(event);
+
+	live_filter.replaying = true;
+	manager->dispatch(event);
+	live_filter.replaying = false;
+}
+
+void
+EventPlayer::Private::filter(bool enable)
+{
+	if (enable)
+		manager->setFilter(&live_filter);
+	else if (&live_filter == manager->filter())
+		manager->setFilter(0);
+}
+
+void
+EventPlayer::Private::replay(const EventRecord &r)
+{
+	const size_t l_source = r.source;
+
+	if (KeyboardEvent::Type().uid() == r.type)
+		dispatch(KeyboardEvent
+		    (static_cast<Input::Keyboard::Key>(r.code),
+		     static_cast<Input::Keyboard::Action>(r.value),
+		     l_source));
+
+	else if (JoystickAxisEvent::Type().uid() == r.type)
+		dispatch(JoystickAxisEvent
+		    (static_cast<Input::Joystick::Axis>(r.code),
+		     static_cast<int>(r.value),
+		     static_cast<int>(r.data[0]),
+		     static_cast<int>(r.data[1]),
+		     l_source));
+
+	else if (JoystickButtonEvent::Type().uid() == r.type)
+		dispatch(JoystickButtonEvent
+		    (static_cast<Input::Joystick::Button>(r.code),
+		     static_cast<Input::Joystick::Action>(r.value),
+		     static_cast<int>(r.data[0]),
+		     l_source));
+
+	else if (TouchEvent::Type().uid() == r.type)
+		dispatch(TouchEvent
+		    (static_cast<Input::Touch::Action>(r.code),
+		     static_cast<int>(r.data[0]),
+		     static_cast<int>(r.data[1]),
+		     l_source));
+
+	else if (SensorEvent::Type().uid() == r.type)
+		dispatch(SensorEvent
+		    (static_cast<Input::Sensor::Type>(r.code),
+		     BitsFloat(r.data[0]),
+		     BitsFloat(r.data[1]),
+		     BitsFloat(r.data[2]),
+		     l_source));
+
+	else MMWARNING("Unknown event type in recording, skipped.");
+}
+
+EventPlayer::EventPlayer(Core::IDataIO *i, EventManager *m)
+    : PIMPL_CREATE_X(*this, m)
+{
+	PIMPL->valid = PIMPL->manager && PIMPL->load(i);
+	if (PIMPL->valid && !isFinished())
+		PIMPL->filter(true);
+}
+
+EventPlayer::~EventPlayer(void)
+{
+	if (PIMPL->manager)
+		PIMPL->filter(false);
+
+	PIMPL_DESTROY;
+}
+
+bool
+EventPlayer::isValid(void) const
+{
+	return(PIMPL->valid);
+}
+
+bool
+EventPlayer::isFinished(void) const
+{
+	return(PIMPL->next >= PIMPL->records.size());
+}
+
+uint32_t
+EventPlayer::step(void) const
+{
+	return(PIMPL->step);
+}
+
+size_t
+EventPlayer::count(void) const
+{
+	return(PIMPL->records.size());
+}
+
+void
+EventPlayer::setStep(uint32_t s)
+{
+	PIMPL->step = s;
+	if (PIMPL->valid)
+		PIMPL->play();
+}
+
+void
+EventPlayer::apply(const InputEvent &)
+{
+}
+
+} /********************************************************** Event Namespace */
+MARSHMALLOW_NAMESPACE_END
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#include "event/eventrecorder.h"
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+#include "core/idataio.h"
+#include "core/logger.h"
+#include "core/platform.h"
+#include "core/type.h"
+
+#include "event/eventmanager.h"
+#include "event/joystickaxisevent.h"
+#include "event/joystickbuttonevent.h"
+#include "event/keyboardevent.h"
+#include "event/sensorevent.h"
+#include "event/touchevent.h"
+
+#include "event/eventrecord_p.h"
+
+#include <cstring>
+#include <vector>
+
+MARSHMALLOW_NAMESPACE_BEGIN
+namespace Event { /****************************************** Event Namespace */
+namespace { /*********************************** Event::<anonymous> Namespace */
+
+	typedef std::vector<EventRecord> EventRecordList;
+
+	/* recorded event types */
+	const Core::Type & (* const s_types[])(void) = {
+		&KeyboardEvent::Type,
+		&JoystickAxisEvent::Type,
+		&JoystickButtonEvent::Type,
+		&TouchEvent::Type,
+		&SensorEvent::Type
+	};
+	const size_t s_types_count = sizeof(s_types) / sizeof(s_types[0]);
+
+	inline int32_t
+	FloatBits(float value)
+	{
+		int32_t l_bits;
+		memcpy(&l_bits, &value, sizeof(l_bits));
+		return(l_bits);
+	}
+
+} /********************************************* Event::<anonymous> Namespace */
+
+struct EventRecorder::Private
+{
+	Private(Core::IDataIO *o, EventManager *m)
+	    : output(o)
+	    , manager(m ? m : EventManager::Instance())
+	    , start(NOW())
+	    , count(0)
+	    , step(0)
+	    , valid(false)
+	{
+		EventRecordHeader l_header;
+		l_header.magic = EVENT_RECORD_MAGIC;
+		l_header.version = EVENT_RECORD_VERSION;
+		l_header.size = sizeof(EventRecord);
+
+		if (!output || !output->isOpen()
+		    || sizeof(l_header) != output->write(&l_header, sizeof(l_header))) {
+			MMERROR("Unable to write recording header.");
+			return;
+		}
+		valid = true;
+
+		records.reserve(EVENT_RECORD_BATCH);
+	}
+
+	inline void record(const IEvent &event);
+
+	inline bool flush(void);
+
+	Core::IDataIO *output;
+	EventManager *manager;
+	EventRecordList records;
+	MMTIME start;
+	size_t count;
+	uint32_t step;
+	bool valid;
+};
+
+void
+EventRecorder::Private::record(const IEvent &event)
+{
+	const Core::Type &l_type = event.type();
+
+	size_t l_i = 0;
+	while (l_i < s_types_count && l_type.uid() != s_types[l_i]().uid())
+		++l_i;
+	if (l_i == s_types_count)
+		return;
+
+	const InputEvent &l_input = static_cast<const InputEvent &>(event);
+
+	EventRecord l_record;
+	memset(&l_record, 0, sizeof(l_record));
+	l_record.step = step;
+	l_record.type = l_type.uid();
+	l_record.time = NOW() - start;
+	l_record.code = l_input.code();
+	l_record.value = l_input.value();
+	l_record.source = static_cast<uint32_t>(l_input.source());
+
+	if (l_type == JoystickAxisEvent::Type()) {
+		const JoystickAxisEvent &l_event =
+		    static_cast<const JoystickAxisEvent &>(event);
+		l_record.data[0] = l_event.minimum();
+		l_record.data[1] = l_event.maximum();
+	}
+	else if (l_type == JoystickButtonEvent::Type()) {
+		l_record.data[0] =
+		    static_cast<const JoystickButtonEvent &>(event).state();
+	}
+	else if (l_type == TouchEvent::Type()) {
+		const TouchEvent &l_event =
+		    static_cast<const TouchEvent &>(event);
+		l_record.data[0] = l_event.x();
+		l_record.data[1] = l_event.y();
+	}
+	else if (l_type == SensorEvent::Type()) {
+		const SensorEvent &l_event =
+		    static_cast<const SensorEvent &>(event);
+		l_record.data[0] = FloatBits(l_event.x());
+		l_record.data[1] = FloatBits(l_event.y());
+		l_record.data[2] = FloatBits(l_event.z());
+	}
+
+	records.push_back(l_record);
+	++count;
+
+	if (records.size() >= EVENT_RECORD_BATCH)
+		flush();
+}
+
+bool
+EventRecorder::Private::flush(void)
+{
+	if (!valid || records.empty())
+		return(valid);
+
+	const size_t l_size = records.size() * sizeof(EventRecord);
+	if (l_size != output->write(&records[0], l_size)) {
+		MMERROR("Failed to write event records.");
+		valid = false;
+	}
+
+	records.clear();
+	return(valid);
+}
+
+EventRecorder::EventRecorder(Core::IDataIO *o, EventManager *m)
+    : PIMPL_CREATE_X(o, m)
+{
+	if (PIMPL->manager)
+		PIMPL->manager->setRecorder(this);
+}
+
+EventRecorder::~EventRecorder(void)
+{
+	if (PIMPL->manager && this == PIMPL->manager->recorder())
+		PIMPL->manager->setRecorder(0);
+
+	PIMPL->flush();
+
+	PIMPL_DESTROY;
+}
+
+size_t
+EventRecorder::count(void) const
+{
+	return(PIMPL->count);
+}
+
+void
+EventRecorder::setStep(uint32_t s)
+{
+	PIMPL->step = s;
+}
+
+uint32_t
+EventRecorder::step(void) const
+{
+	return(PIMPL->step);
+}
+
+bool
+EventRecorder::flush(void)
+{
+	return(PIMPL->flush());
+}
+
+bool
+EventRecorder::handleEvent(const IEvent &e)
+{
+	PIMPL->record(e);
+	return(false);
+}
+
+} /********************************************************** Event Namespace */
+MARSHMALLOW_NAMESPACE_END
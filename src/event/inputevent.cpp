@@ -44,52 +44,42 @@
 MARSHMALLOW_NAMESPACE_BEGIN
 namespace Event { /****************************************** Event Namespace */
 
-struct InputEvent::Private
-{
-	InputType type;
-	int code;
-	int value;
-	size_t source;
-};
-
 InputEvent::InputEvent(InputType type_, int code_, int value_, size_t source_,
                        MMTIME time_)
     : Event(time_, HighPriority)
-    , PIMPL_CREATE
+    , m_type(type_)
+    , m_code(code_)
+    , m_value(value_)
+    , m_source(source_)
 {
-	PIMPL->type = type_;
-	PIMPL->code = code_;
-	PIMPL->value = value_;
-	PIMPL->source = source_;
 }
 
 InputEvent::~InputEvent(void)
 {
-	PIMPL_DESTROY;
 }
 
 InputEvent::InputType
 InputEvent::inputType(void) const
 {
-	return(PIMPL->type);
+	return(m_type);
 }
 
 int
 InputEvent::code(void) const
 {
-	return(PIMPL->code);
+	return(m_code);
 }
 
 int
 InputEvent::value(void) const
 {
-	return(PIMPL->value);
+	return(m_value);
 }
 
 size_t
 InputEvent::source(void) const
 {
-	return(PIMPL->source);
+	return(m_source);
 }
 
 const Core::Type &
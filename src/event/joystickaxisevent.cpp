@@ -43,12 +43,6 @@
 MARSHMALLOW_NAMESPACE_BEGIN
 namespace Event { /****************************************** Event Namespace */
 
-struct JoystickAxisEvent::Private
-{
-	int minimum;
-	int maximum;
-};
-
 JoystickAxisEvent::JoystickAxisEvent(
     Input::Joystick::Axis axis_,
     int value_,
@@ -57,27 +51,25 @@ JoystickAxisEvent::JoystickAxisEvent(
     size_t source_,
     MMTIME timestamp_)
     : InputEvent(Joystick, axis_, value_, source_, timestamp_)
-    , PIMPL_CREATE
+    , m_minimum(minimum_)
+    , m_maximum(maximum_)
 {
-	PIMPL->minimum = minimum_;
-	PIMPL->maximum = maximum_;
 }
 
 JoystickAxisEvent::~JoystickAxisEvent(void)
 {
-	PIMPL_DESTROY;
 }
 
 int
 JoystickAxisEvent::minimum(void) const
 {
-	return(PIMPL->minimum);
+	return(m_minimum);
 }
 
 int
 JoystickAxisEvent::maximum(void) const
 {
-	return(PIMPL->maximum);
+	return(m_maximum);
 }
 
 const Core::Type &
@@ -87,6 +79,15 @@ JoystickAxisEvent::Type(void)
 	return(s_type);
 }
 
+bool
+JoystickAxisEvent::CoalesceKey(const IEvent &event, uint32_t &key)
+{
+	const JoystickAxisEvent &l_event = static_cast<const JoystickAxisEvent &>(event);
+	key = (static_cast<uint32_t>(l_event.source()) << 16)
+	    | (static_cast<uint32_t>(l_event.code()) & 0xFFFF);
+	return(true);
+}
+
 } /********************************************************** Event Namespace */
 MARSHMALLOW_NAMESPACE_END
 
@@ -43,11 +43,6 @@
 MARSHMALLOW_NAMESPACE_BEGIN
 namespace Event { /****************************************** Event Namespace */
 
-struct JoystickButtonEvent::Private
-{
-	int state;
-};
-
 JoystickButtonEvent::JoystickButtonEvent(
     Input::Joystick::Button button_,
     Input::Joystick::Action action_,
@@ -55,14 +50,12 @@ JoystickButtonEvent::JoystickButtonEvent(
     size_t source_,
     MMTIME timestamp_)
     : InputEvent(Joystick, button_, action_, source_, timestamp_)
-    , PIMPL_CREATE
+    , m_state(state_)
 {
-	PIMPL->state = state_;
 }
 
 JoystickButtonEvent::~JoystickButtonEvent(void)
 {
-	PIMPL_DESTROY;
 }
 
 const Core::Type &
@@ -72,16 +65,24 @@ JoystickButtonEvent::Type(void)
 	return(s_type);
 }
 
+bool
+JoystickButtonEvent::SubscriptionKey(const IEvent &event, uint32_t &key)
+{
+	key = static_cast<uint32_t>
+	    (static_cast<const JoystickButtonEvent &>(event).code());
+	return(true);
+}
+
 int
 JoystickButtonEvent::state(void) const
 {
-	return(PIMPL->state);
+	return(m_state);
 }
 
 bool
 JoystickButtonEvent::pressed(int button_) const
 {
-	return(button_ == (PIMPL->state & button_));
+	return(button_ == (m_state & button_));
 }
 
 } /********************************************************** Event Namespace */
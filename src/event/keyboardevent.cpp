@@ -63,6 +63,14 @@ KeyboardEvent::Type(void)
 	return(s_type);
 }
 
+bool
+KeyboardEvent::SubscriptionKey(const IEvent &event, uint32_t &key)
+{
+	key = static_cast<uint32_t>
+	    (static_cast<const KeyboardEvent &>(event).code());
+	return(true);
+}
+
 } /********************************************************** Event Namespace */
 MARSHMALLOW_NAMESPACE_END
 
@@ -43,8 +43,9 @@
 MARSHMALLOW_NAMESPACE_BEGIN
 namespace Event { /****************************************** Event Namespace */
 
-RenderEvent::RenderEvent(void)
+RenderEvent::RenderEvent(float a)
     : Event(0, HighestPriority)
+    , m_alpha(a)
 {
 }
 
@@ -52,6 +53,12 @@ RenderEvent::~RenderEvent(void)
 {
 }
 
+float
+RenderEvent::alpha(void) const
+{
+	return(m_alpha);
+}
+
 const Core::Type &
 RenderEvent::Type(void)
 {
@@ -45,46 +45,37 @@
 MARSHMALLOW_NAMESPACE_BEGIN
 namespace Event { /****************************************** Event Namespace */
 
-struct SensorEvent::Private
-{
-	float x;
-	float y;
-	float z;
-};
-
 SensorEvent::SensorEvent(Input::Sensor::Type type_,
                        float x_, float y_, float z_,
                        size_t source_,
                        MMTIME timestamp_)
     : InputEvent(Sensor, type_, 0, source_, timestamp_)
-    , PIMPL_CREATE
+    , m_x(x_)
+    , m_y(y_)
+    , m_z(z_)
 {
-	PIMPL->x = x_;
-	PIMPL->y = y_;
-	PIMPL->z = z_;
 }
 
 SensorEvent::~SensorEvent(void)
 {
-	PIMPL_DESTROY;
 }
 
 float
 SensorEvent::x() const
 {
-	return(PIMPL->x);
+	return(m_x);
 }
 
 float
 SensorEvent::y() const
 {
-	return(PIMPL->y);
+	return(m_y);
 }
 
 float
 SensorEvent::z() const
 {
-	return(PIMPL->z);
+	return(m_z);
 }
 
 const Core::Type &
@@ -94,6 +85,15 @@ SensorEvent::Type(void)
 	return(s_type);
 }
 
+bool
+SensorEvent::CoalesceKey(const IEvent &event, uint32_t &key)
+{
+	const SensorEvent &l_event = static_cast<const SensorEvent &>(event);
+	key = (static_cast<uint32_t>(l_event.source()) << 16)
+	    | (static_cast<uint32_t>(l_event.code()) & 0xFFFF);
+	return(true);
+}
+
 } /********************************************************** Event Namespace */
 MARSHMALLOW_NAMESPACE_END
 
@@ -45,39 +45,31 @@
 MARSHMALLOW_NAMESPACE_BEGIN
 namespace Event { /****************************************** Event Namespace */
 
-struct TouchEvent::Private
-{
-	int x;
-	int y;
-};
-
 TouchEvent::TouchEvent(Input::Touch::Action action_,
                        int x_,
                        int y_,
                        size_t source_,
                        MMTIME timestamp_)
     : InputEvent(Touch, action_, 0, source_, timestamp_)
-    , PIMPL_CREATE
+    , m_x(x_)
+    , m_y(y_)
 {
-	PIMPL->x = x_;
-	PIMPL->y = y_;
 }
 
 TouchEvent::~TouchEvent(void)
 {
-	PIMPL_DESTROY;
 }
 
 int
 TouchEvent::x() const
 {
-	return(PIMPL->x);
+	return(m_x);
 }
 
 int
 TouchEvent::y() const
 {
-	return(PIMPL->y);
+	return(m_y);
 }
 
 const Core::Type &
@@ -87,6 +79,19 @@ TouchEvent::Type(void)
 	return(s_type);
 }
 
+bool
+TouchEvent::CoalesceKey(const IEvent &event, uint32_t &key)
+{
+	const TouchEvent &l_event = static_cast<const TouchEvent &>(event);
+
+	/* presses and releases must never be dropped */
+	if (Input::Touch::Move != l_event.action())
+		return(false);
+
+	key = static_cast<uint32_t>(l_event.source());
+	return(true);
+}
+
 } /********************************************************** Event Namespace */
 MARSHMALLOW_NAMESPACE_END
 
@@ -54,6 +54,7 @@
 #include "game/entity.h"
 #include "game/entityscenelayer.h"
 #include "game/factory.h"
+#include "game/icomponentpool.h"
 #include "game/positioncomponent.h"
 #include "game/propertycomponent.h"
 #include "game/rendercomponent.h"
@@ -93,6 +94,19 @@ namespace { /*********************************** Extra::<anonymous> Namespace */
 		                       static_cast<float>(p[2]) / 255.f));
 	}
 
+	/* construct from the entity layer pool when it has one */
+	template <class T>
+	T *
+	CreateComponent(const Core::Identifier &i, Game::IEntity *e)
+	{
+		Game::EntitySceneLayer *l_layer = e->layer();
+		Game::IComponentPool *l_pool =
+		    l_layer ? l_layer->componentPool(T::Type()) : 0;
+		if (l_pool)
+			return(static_cast<T *>(l_pool->create(i, e)));
+		return(new T(i, e));
+	}
+
 } /********************************************* Extra::<anonymous> Namespace */
 
 struct TMXLoader::Private
@@ -425,7 +439,18 @@ TMXLoader::Private::processObjectGroup(TinyXML::XMLElement &e)
 		return(false);
 	}
 
-	Game::EntitySceneLayer *l_layer = new Game::EntitySceneLayer(l_name, scene);
+	/* created by the factory, games may register component pools there */
+	Game::ISceneLayer *l_scene_layer = Game::Factory::Instance()->
+	    createSceneLayer(Game::EntitySceneLayer::Type(), l_name, scene);
+	if (!l_scene_layer
+	    || l_scene_layer->type() != Game::EntitySceneLayer::Type()) {
+		MMWARNING("Factory failed to create an entity layer for object group '" << l_name << "'.");
+		delete l_scene_layer;
+		return(false);
+	}
+
+	Game::EntitySceneLayer *l_layer =
+	    static_cast<Game::EntitySceneLayer *>(l_scene_layer);
 
 	TinyXML::XMLElement *l_object = e.FirstChildElement(TMXOBJECTGROUP_OBJECT_NODE);
 	while (l_object) {
@@ -506,13 +531,13 @@ TMXLoader::Private::processObjectGroup(TinyXML::XMLElement &e)
 
 			/* attach tileset used */
 
-			Game::TilesetComponent *l_tscomponent = new Game::TilesetComponent("tileset", l_entity);
+			Game::TilesetComponent *l_tscomponent = CreateComponent<Game::TilesetComponent>("tileset", l_entity);
 			l_tscomponent->setTileset(l_tileset);
 			l_entity->addComponent(l_tscomponent);
 
 			/* generate tile mesh */
 
-			Game::RenderComponent *l_render = new Game::RenderComponent("render", l_entity);
+			Game::RenderComponent *l_render = CreateComponent<Game::RenderComponent>("render", l_entity);
 
 			Graphics::IVertexData *l_vdata =
 			    Graphics::Factory::CreateVertexData(MARSHMALLOW_QUAD_VERTEXES);
@@ -531,7 +556,7 @@ TMXLoader::Private::processObjectGroup(TinyXML::XMLElement &e)
 		}
 
 		/* create position component */
-		Game::PositionComponent *l_pos_component = new Game::PositionComponent("position", l_entity);
+		Game::PositionComponent *l_pos_component = CreateComponent<Game::PositionComponent>("position", l_entity);
 		l_pos_component->setPosition(scale.width  * float(l_object_x),
 		                             scale.height * float(l_object_y));
 
@@ -542,7 +567,7 @@ TMXLoader::Private::processObjectGroup(TinyXML::XMLElement &e)
 		l_entity->addComponent(l_pos_component);
 
 		/* create size component */
-		Game::SizeComponent *l_size = new Game::SizeComponent("size", l_entity);
+		Game::SizeComponent *l_size = CreateComponent<Game::SizeComponent>("size", l_entity);
 		l_size->set(l_object_rsize);
 		l_entity->addComponent(l_size);
 
@@ -551,7 +576,7 @@ TMXLoader::Private::processObjectGroup(TinyXML::XMLElement &e)
 		TinyXML::XMLElement *l_property = l_properties ? l_properties->FirstChildElement(TMXPROPERTIES_PROPERTY_NODE) : 0;
 		if (l_property) {
 			Game::PropertyComponent *l_pcomponent =
-			    new Game::PropertyComponent("property", l_entity);
+			    CreateComponent<Game::PropertyComponent>("property", l_entity);
 
 			do {
 				const char *l_pname = l_property->Attribute("name");
@@ -67,6 +67,8 @@ struct AnimationComponent::Private
 	    , current_framelist(0)
 	    , render(0)
 	    , tileset(0)
+	    , stop_data(0)
+	    , current_frame_entries(0)
 	    , current_frame_entry(0)
 	    , current_frame_duration(0)
 	    , current_framerate(0.f)
@@ -82,6 +84,7 @@ struct AnimationComponent::Private
 	inline float frameRate(const Core::Identifier &animation) const;
 
 	inline void play(const Core::Identifier &animation, bool loop);
+	inline void rewind(void);
 	inline void stop(uint16_t *tile);
 	inline void animate(float d);
 
@@ -136,13 +139,20 @@ AnimationComponent::Private::frameRate(const Core::Identifier &a) const
 }
 
 void
-AnimationComponent::Private::stop(uint16_t *s)
+AnimationComponent::Private::rewind(void)
 {
 	playing = false;
 	current_frame_duration = 0;
 	current_frame_entries = 0;
 	current_frame_entry = 0;
 	current_framelist = 0;
+	timestamp = 0;
+}
+
+void
+AnimationComponent::Private::stop(uint16_t *s)
+{
+	rewind();
 
 	if (s) stop_data = tileset->tileset()->getTextureCoordinateData(*s);
 
@@ -242,13 +252,13 @@ AnimationComponent::Private::animate(float d)
 AnimationComponent::AnimationComponent(const Core::Identifier &i,
                                        Game::IEntity *e)
     : Component(i, e)
-    , PIMPL_CREATE_X(*this)
+    , COMPONENT_PIMPL_CREATE_X(*this)
 {
 }
 
 AnimationComponent::~AnimationComponent(void)
 {
-	PIMPL_DESTROY;
+	COMPONENT_PIMPL_DESTROY;
 }
 
 void
@@ -299,6 +309,22 @@ AnimationComponent::stop(uint16_t *s)
 	PIMPL->stop(s);
 }
 
+bool
+AnimationComponent::playing(void) const
+{
+	return(PIMPL->playing);
+}
+
+void
+AnimationComponent::reset(void)
+{
+	/* restore the frame shown before playback */
+	if (PIMPL->playing && PIMPL->render)
+		PIMPL->stop(0);
+	else
+		PIMPL->rewind();
+}
+
 void
 AnimationComponent::update(float d)
 {
@@ -67,6 +67,7 @@ struct Box2DComponent::Private
 	    , body_type(b2_staticBody)
 	    , density(1.f)
 	    , friction(0.3f)
+	    , dormant(false)
 	    , init(false)
 	{}
 
@@ -80,18 +81,19 @@ struct Box2DComponent::Private
 	int   body_type;
 	float density;
 	float friction;
+	bool  dormant;
 	bool  init;
 };
 
 Box2DComponent::Box2DComponent(const Core::Identifier &i, Game::IEntity *e)
     : Component(i, e)
-    , PIMPL_CREATE
+    , COMPONENT_PIMPL_CREATE
 {
 }
 
 Box2DComponent::~Box2DComponent(void)
 {
-	PIMPL_DESTROY;
+	COMPONENT_PIMPL_DESTROY;
 }
 
 b2Body *
@@ -124,6 +126,15 @@ Box2DComponent::size(void)
 	return(PIMPL->size);
 }
 
+void
+Box2DComponent::reset(void)
+{
+	/* inactive bodies leave the broad-phase, the body is kept for reuse */
+	if (PIMPL->body)
+		PIMPL->body->SetActive(false);
+	PIMPL->dormant = true;
+}
+
 void
 Box2DComponent::update(float d)
 {
@@ -131,17 +142,17 @@ Box2DComponent::update(float d)
 
 	if (!PIMPL->position) {
 		PIMPL->position = static_cast<PositionComponent *>
-		    (entity()->getComponentType("Game::PositionComponent"));
+		    (entity()->getComponentType(PositionComponent::Type()));
 	}
 
 	if (!PIMPL->render) {
 		PIMPL->render = static_cast<RenderComponent *>
-		    (entity()->getComponentType("Game::RenderComponent"));
+		    (entity()->getComponentType(RenderComponent::Type()));
 	}
 
 	if (!PIMPL->init && !PIMPL->b2layer && PIMPL->position) {
 		PIMPL->b2layer = static_cast<Box2DSceneLayer *>
-		    (entity()->layer()->scene()->getLayerType("Game::Box2DSceneLayer"));
+		    (entity()->layer()->scene()->getLayerType(Box2DSceneLayer::Type()));
 
 		if (!PIMPL->b2layer) {
 			MMWARNING("Box2DComponent used with non Box2D Scene!");
@@ -179,6 +190,21 @@ Box2DComponent::update(float d)
 	if (!PIMPL->init)
 		return;
 
+	/* pooled entity is back in play, body starts over where it spawned */
+	if (PIMPL->dormant) {
+		const Math::Point2 &l_spawn = PIMPL->position->position();
+		const float l_spawn_angle = PIMPL->render ?
+		    PIMPL->render->mesh()->rotation() * DEGREE_TO_RADIAN : 0.f;
+
+		PIMPL->body->SetTransform(b2Vec2(l_spawn.x, l_spawn.y),
+		    l_spawn_angle);
+		PIMPL->body->SetLinearVelocity(b2Vec2(0.f, 0.f));
+		PIMPL->body->SetAngularVelocity(0.f);
+		PIMPL->body->SetActive(true);
+		PIMPL->body->SetAwake(true);
+		PIMPL->dormant = false;
+	}
+
 	b2Vec2 l_position = PIMPL->body->GetPosition();
 	float32 l_angle = PIMPL->body->GetAngle();
 
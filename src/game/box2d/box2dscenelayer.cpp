@@ -53,14 +53,26 @@ struct Box2DSceneLayer::Private
 {
 	Private()
 	    : world(b2Vec2(.0f, -10.f))
-	    , accumulator(.0f)
 	{}
 
+	inline void step(float delta);
+
 	Graphics::Transform transform;
 	b2World world;
-	float accumulator;
 };
 
+void
+Box2DSceneLayer::Private::step(float d)
+{
+	world.Step
+	    (d,
+#define VELOCITY_ITERATIONS 8
+	     VELOCITY_ITERATIONS,
+#define POSITION_ITERATIONS 3
+	     POSITION_ITERATIONS);
+	world.ClearForces();
+}
+
 Box2DSceneLayer::Box2DSceneLayer(const Core::Identifier &i, Game::IScene *s)
     : SceneLayer(i, s)
     , PIMPL_CREATE
@@ -72,23 +84,15 @@ Box2DSceneLayer::~Box2DSceneLayer(void)
 	PIMPL_DESTROY;
 }
 
+/*
+ * Updates are paced by the engine (see Engine::setFixedStep), the world is
+ * stepped by the delta we are given.
+ */
 void
 Box2DSceneLayer::update(float d)
 {
-	static const float step(1.f/60.f);
-
-	PIMPL->accumulator += d;
-	while (PIMPL->accumulator >= step) {
-		PIMPL->accumulator -= step;
-
-		PIMPL->world.Step
-		    (step,
-#define VELOCITY_ITERATIONS 8
-		     VELOCITY_ITERATIONS,
-#define POSITION_ITERATIONS 3
-		     POSITION_ITERATIONS);
-		PIMPL->world.ClearForces();
-	}
+	if (d > 0)
+		PIMPL->step(d);
 }
 
 Math::Vector2
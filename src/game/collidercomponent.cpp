@@ -71,6 +71,7 @@ struct ColliderComponent::Private
 	    , body(Box)
 	    , bullet_resolution(DELTA_STEPS)
 	    , flags(Active)
+	    , dormant(false)
 	    , init(false)
 	{}
 
@@ -96,6 +97,7 @@ struct ColliderComponent::Private
 	BodyType body;
 	int  bullet_resolution;
 	int  flags;
+	bool dormant;
 	bool init;
 };
 
@@ -200,6 +202,9 @@ ColliderComponent::Private::radius2(void) const
 void
 ColliderComponent::Private::update(float d)
 {
+	/* pooled entity is back in play */
+	dormant = false;
+
 	if (!init) {
 		if (!movement) {
 			movement = static_cast<MovementComponent *>
@@ -241,9 +246,10 @@ ColliderComponent::Private::update(float d)
 	ColliderList::const_iterator l_c = layer->colliders().end();
 
 	for (l_i = layer->colliders().begin(); l_i != l_c; ++l_i) {
-		if (*l_i == &component) continue;
-
 		ColliderComponent *l_collider = *l_i;
+		if (l_collider == &component || l_collider->PIMPL->dormant)
+			continue;
+
 		CollisionData data[2];
 		memset(&data, 0, sizeof(data));
 
@@ -274,13 +280,13 @@ ColliderComponent::Private::update(float d)
 ColliderComponent::ColliderComponent(const Core::Identifier &i,
                                      Game::IEntity *e)
     : Component(i, e)
-    , PIMPL_CREATE_X(*this)
+    , COMPONENT_PIMPL_CREATE_X(*this)
 {
 }
 
 ColliderComponent::~ColliderComponent(void)
 {
-	PIMPL_DESTROY;
+	COMPONENT_PIMPL_DESTROY;
 }
 
 ColliderComponent::BodyType
@@ -363,6 +369,16 @@ ColliderComponent::radius2(void) const
 	return(PIMPL->radius2());
 }
 
+void
+ColliderComponent::reset(void)
+{
+	/*
+	 * Dormant entities must not collide, the collider stays registered
+	 * and gets skipped until its next update.
+	 */
+	PIMPL->dormant = true;
+}
+
 void
 ColliderComponent::update(float d)
 {
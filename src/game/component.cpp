@@ -43,26 +43,59 @@
 
 MARSHMALLOW_NAMESPACE_BEGIN
 namespace Game { /******************************************** Game Namespace */
+namespace { /************************************ Game::<anonymous> Namespace */
+
+	/* storage for the component under construction (see BeginState) */
+	struct StateReservation
+	{
+		char *cursor;
+		size_t used;
+		bool active;
+	} s_state = { 0, 0, false };
+
+	void *
+	ReserveState(size_t size)
+	{
+#define STATE_ALIGN (2 * sizeof(void *))
+		s_state.used += (size + STATE_ALIGN - 1) & ~(STATE_ALIGN - 1);
+
+		/* measuring only */
+		if (!s_state.cursor)
+			return(::operator new(size));
+
+		char *l_state = s_state.cursor;
+		s_state.cursor += (size + STATE_ALIGN - 1) & ~(STATE_ALIGN - 1);
+		return(l_state);
+	}
+} /********************************************** Game::<anonymous> Namespace */
 
 struct Component::Private
 {
-	Private(const Core::Identifier &i, Game::IEntity *e)
+	Private(const Core::Identifier &i, Game::IEntity *e, bool p)
 	    : id(i)
 	    , entity(e)
+	    , pooled(p)
 	{}
 
 	Core::Identifier id;
 	Game::IEntity *entity;
+	bool pooled;
 };
 
 Component::Component(const Core::Identifier &i, Game::IEntity *e)
-    : PIMPL(new Private(i, e))
+    : PIMPL(new (s_state.active ? ReserveState(sizeof(Private)) :
+                 ::operator new(sizeof(Private)))
+            Private(i, e, s_state.active && s_state.cursor))
 {
 }
 
 Component::~Component(void)
 {
-	delete PIMPL, PIMPL = 0;
+	const bool l_pooled = PIMPL->pooled;
+	PIMPL->~Private();
+	if (!l_pooled)
+		::operator delete(PIMPL);
+	PIMPL = 0;
 }
 
 const Core::Identifier &
@@ -77,6 +110,36 @@ Component::entity(void) const
 	return(PIMPL->entity);
 }
 
+void
+Component::BeginState(char *s)
+{
+	s_state.cursor = s;
+	s_state.used = 0;
+	s_state.active = true;
+}
+
+size_t
+Component::EndState(void)
+{
+	s_state.cursor = 0;
+	s_state.active = false;
+	return(s_state.used);
+}
+
+void *
+Component::allocateState(size_t s)
+{
+	/* only set while a pool constructs this component */
+	return(s_state.active ? ReserveState(s) : ::operator new(s));
+}
+
+void
+Component::releaseState(void *s)
+{
+	if (!PIMPL->pooled)
+		::operator delete(s);
+}
+
 } /*********************************************************** Game Namespace */
 MARSHMALLOW_NAMESPACE_END
 
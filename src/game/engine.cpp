@@ -38,24 +38,45 @@
  * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
  */
 
+#include "core/atomic.h"
+#include "core/fileio.h"
+#include "core/framearena.h"
 #include "core/identifier.h"
+#include "core/jobs.h"
 #include "core/logger.h"
 #include "core/platform.h"
+#include "core/semaphore.h"
+#include "core/thread.h"
 #include "core/type.h"
 
 #include "event/eventmanager.h"
+#include "event/eventplayer.h"
+#include "event/eventrecorder.h"
+#include "event/joystickaxisevent.h"
+#include "event/joystickbuttonevent.h"
+#include "event/keyboardevent.h"
 #include "event/quitevent.h"
 #include "event/renderevent.h"
+#include "event/sensorevent.h"
+#include "event/touchevent.h"
 #include "event/updateevent.h"
 
 #include "graphics/backend_p.h"
 #include "graphics/display.h"
+#include "graphics/drawlist_p.h"
 #include "graphics/painter_p.h"
 
+#include "input/joystick_p.h"
+#include "input/keyboard_p.h"
+
 #include "game/backend_p.h"
 #include "game/factory.h"
+#include "game/featureschedule_p.h"
+#include "game/framepacer.h"
+#include "game/framestats.h"
 #include "game/ienginefeature.h"
 #include "game/scenemanager.h"
+#include "game/stepclock.h"
 
 #include <cassert>
 #include <cmath>
@@ -66,6 +87,49 @@ MARSHMALLOW_NAMESPACE_BEGIN
 namespace Game { /******************************************** Game Namespace */
 namespace { /************************************ Game::<anonymous> Namespace */
 
+/*
+ * Replayed events carry their input state along, live input state is
+ * ignored for as long as the player is around.
+ */
+class InputReplay : public Event::EventPlayer
+{
+	NO_ASSIGN_COPY(InputReplay);
+public:
+
+	InputReplay(Core::IDataIO *input, Event::EventManager *manager)
+	    : EventPlayer(input, manager)
+	{
+		Input::Keyboard::SetReplaying(true);
+		Input::Joystick::SetReplaying(true);
+	}
+
+	~InputReplay(void)
+	{
+		Input::Joystick::SetReplaying(false);
+		Input::Keyboard::SetReplaying(false);
+	}
+
+protected: /* reimp */
+
+	VIRTUAL void apply(const Event::InputEvent &event)
+	{
+		const Core::Type &l_type = event.type();
+
+		if (Event::KeyboardEvent::Type() == l_type) {
+			const Event::KeyboardEvent &l_event =
+			    static_cast<const Event::KeyboardEvent &>(event);
+			Input::Keyboard::ReplayKeyState(l_event.key(),
+			    l_event.action());
+		}
+		else if (Event::JoystickButtonEvent::Type() == l_type) {
+			const Event::JoystickButtonEvent &l_event =
+			    static_cast<const Event::JoystickButtonEvent &>(event);
+			Input::Joystick::ReplayButtonState(l_event.source(),
+			    l_event.state());
+		}
+	}
+};
+
 static void
 GetBackendOverrides(Graphics::Display &display)
 {
@@ -95,7 +159,110 @@ GetBackendOverrides(Graphics::Display &display)
 	}
 }
 
-typedef std::list<IEngineFeature *> EngineFeatureList;
+static void
+GetEventOverrides(Event::EventManager &manager)
+{
+	const char *l_env;
+	if ((l_env = getenv("MM_EVENT_STATS")))
+		manager.setStatsEnabled(l_env[0] == '1');
+
+	/* per frame event budget, time in milliseconds */
+	float l_time = 0;
+	unsigned int l_count = 0;
+	if ((l_env = getenv("MM_EVENT_BUDGET")))
+		sscanf(l_env, "%f", &l_time);
+	if ((l_env = getenv("MM_EVENT_LIMIT")))
+		sscanf(l_env, "%u", &l_count);
+	if (l_time > 0 || l_count > 0)
+		manager.setBudget(l_time / 1000.f, l_count);
+}
+
+static void
+GetBenchmarkOverrides(unsigned int &frames, float &delta)
+{
+	const char *l_env;
+	if ((l_env = getenv("MM_BENCH_FRAMES")))
+		sscanf(l_env, "%u", &frames);
+
+	/* fixed delta time, in seconds */
+	if ((l_env = getenv("MM_BENCH_DELTA")))
+		sscanf(l_env, "%f", &delta);
+	if (delta <= 0)
+		delta = 1.f / 60.f;
+}
+
+static void
+LogBenchmark(const FrameStats &stats, const FeatureSchedule &features,
+    MMTIME wall)
+{
+	const size_t l_frames = stats.total();
+
+	fprintf(stderr, "BENCH: frames=%u wall=%.3fs fps=%.1f\n",
+	    unsigned(l_frames), wall,
+	    wall > 0 ? double(l_frames) / wall : 0.);
+
+	for (int i = 0; i < FrameStats::Phases; ++i) {
+		const FrameStats::Phase l_phase = FrameStats::Phase(i);
+		fprintf(stderr, "BENCH: %-14s avg=%.3fms p50=%.3fms p95=%.3fms"
+		    " p99=%.3fms worst=%.3fms\n",
+		    FrameStats::PhaseName(l_phase),
+		    stats.average(l_phase) * 1000.,
+		    stats.percentile(l_phase, 50) * 1000.,
+		    stats.percentile(l_phase, 95) * 1000.,
+		    stats.percentile(l_phase, 99) * 1000.,
+		    stats.worst(l_phase) * 1000.);
+	}
+
+	for (size_t i = 0; i < features.size(); ++i) {
+		const FeatureSchedule::Slot &l_slot = features.slot(i);
+		const uint32_t l_ticks = l_slot.ticks;
+		fprintf(stderr, "BENCH: feature %s level=%d %s avg=%.3fms"
+		    " worst=%.3fms\n",
+		    l_slot.feature->type().str().c_str(), l_slot.level,
+		    l_slot.worker ? "worker" : "main",
+		    l_ticks ? l_slot.time_total * 1000. / l_ticks : 0.,
+		    l_slot.time_max * 1000.);
+	}
+
+	const Core::FrameArena &l_arena = Core::FrameArena::Instance();
+	fprintf(stderr, "BENCH: frame arena peak=%ukB capacity=%ukB\n",
+	    unsigned(l_arena.peak() / 1024), unsigned(l_arena.capacity() / 1024));
+}
+
+static void
+LogEventStats(Event::EventManager &manager)
+{
+	const Event::EventManager::Stats l_stats = manager.stats();
+
+	fprintf(stderr, "EVENTS: depth=%u peak=%u schedule_peak=%u backlog=%u\n",
+	    unsigned(l_stats.queue_depth), unsigned(l_stats.queue_peak),
+	    unsigned(l_stats.schedule_peak), unsigned(l_stats.backlog));
+
+	for (size_t i = 0; i < l_stats.type_count; ++i) {
+		const Event::EventManager::TypeStats &l_type = l_stats.types[i];
+		const uint32_t l_queued = l_type.queued - l_type.coalesced;
+		fprintf(stderr, "EVENTS: %s queued=%u coalesced=%u dispatched=%u"
+		    " handled=%u latency_avg=%.3fms latency_max=%.3fms\n",
+		    l_type.type.str().c_str(), l_type.queued, l_type.coalesced,
+		    l_type.dispatched, l_type.handled,
+		    l_queued ? l_type.latency * 1000. / l_queued : 0.,
+		    l_type.latency_max * 1000.);
+	}
+
+	for (size_t i = 0; i < l_stats.listener_count; ++i) {
+		const Event::EventManager::ListenerStats &l_listener =
+		    l_stats.listeners[i];
+		if (!l_listener.calls)
+			continue;
+		fprintf(stderr, "EVENTS: listener %p %s calls=%u"
+		    " time_avg=%.3fms time_max=%.3fms\n",
+		    l_listener.listener, l_listener.type.str().c_str(),
+		    l_listener.calls, l_listener.time * 1000. / l_listener.calls,
+		    l_listener.time_max * 1000.);
+	}
+
+	manager.resetStats();
+}
 
 } /********************************************** Game::<anonymous> Namespace */
 
@@ -104,12 +271,27 @@ struct Engine::Private
 	Private(Engine *i)
 	    : _interface(i)
 	    , event_manager(0)
+	    , event_recorder(0)
+	    , event_player(0)
 	    , factory(0)
 	    , scene_manager(0)
 	    , delta_time(0)
 	    , exit_code(0)
 	    , frame_rate(0)
 	    , frame_rate_max(MARSHMALLOW_ENGINE_FRAME_RATE_MAX)
+	    , bench_frames(0)
+	    , bench_delta(0)
+	    , step_clock(MARSHMALLOW_ENGINE_STEP_RATE > 0 ?
+	          1.f / float(MARSHMALLOW_ENGINE_STEP_RATE) : 0.f)
+	    , step_count(0)
+	    , frame_count(0)
+	    , render_thread(RenderThread, this)
+	    , render_free(2)
+	    , draw_record(0)
+	    , draw_submit(0)
+	    , render_quit(0)
+	    , render_context(false)
+	    , features_dirty(true)
 	    , running(false)
 	    , suspended(false)
 	{}
@@ -125,12 +307,36 @@ struct Engine::Private
 	inline void
 	render(void);
 
+	inline void
+	renderRecord(void);
+
+	inline bool
+	startRenderThread(void);
+
+	inline void
+	stopRenderThread(void);
+
+	static void
+	RenderThread(void *data);
+
+	inline void
+	startEventRecording(void);
+
+	inline void
+	stopEventRecording(void);
+
 	inline void
 	second(void);
 
 	inline void
 	update(float delta);
 
+	inline void
+	tickFeatures(float delta);
+
+	inline void
+	step(float delta);
+
 	inline int
 	run(void);
 
@@ -149,16 +355,42 @@ struct Engine::Private
 	inline void
 	recalculateRenderTarget();
 
+	inline MMTIME
+	phase(FrameStats::Phase phase, MMTIME start);
+
 	EngineFeatureList    features;
+	FeatureSchedule      feature_schedule;
 	Engine              *_interface;
 	Event::EventManager *event_manager;
+	Event::EventRecorder *event_recorder;
+	Event::EventPlayer  *event_player;
+	Core::FileIO         event_io;
 	Game::IFactory      *factory;
 	Game::SceneManager  *scene_manager;
+	Game::FrameStats     frame_stats;
+	Game::FramePacer     frame_pacer;
 	float  render_target;
 	float  delta_time;
 	int    exit_code;
 	unsigned short frame_rate;
 	unsigned short frame_rate_max;
+	unsigned int bench_frames;
+	float  bench_delta;
+	StepClock step_clock;
+	uint32_t step_count;
+	uint32_t frame_count;
+
+	/* pipelined rendering, see RenderThread */
+	Core::Thread        render_thread;
+	Core::Semaphore     render_free;
+	Core::Semaphore     render_submit;
+	Core::Semaphore     render_ready;
+	Graphics::DrawList  draw_list[2];
+	int    draw_record;
+	int    draw_submit;
+	volatile int32_t render_quit;
+	bool   render_context;
+	bool   features_dirty;
 	bool   running;
 	bool   suspended;
 
@@ -184,9 +416,37 @@ Engine::Private::initialize(void)
 
 	Platform::Initialize();
 
+	/* job workers, MM_JOB_WORKERS overrides the per-core default */
+	unsigned int l_workers = 0;
+	const char *l_env;
+	if ((l_env = getenv("MM_JOB_WORKERS")))
+		sscanf(l_env, "%u", &l_workers);
+	Jobs::Initialize(l_workers);
+
 	if (!event_manager)
 		event_manager = new Event::EventManager("Engine.EventManager");
 	event_manager->connect(_interface, Event::QuitEvent::Type());
+	GetEventOverrides(*event_manager);
+	startEventRecording();
+
+	/* benchmark mode keeps every frame for the exit report */
+	GetBenchmarkOverrides(bench_frames, bench_delta);
+	if (bench_frames > 0)
+		frame_stats.setCapacity(bench_frames);
+
+	/* high-frequency input, only the latest state matters */
+	event_manager->setCoalescer(Event::JoystickAxisEvent::Type(),
+	    Event::JoystickAxisEvent::CoalesceKey);
+	event_manager->setCoalescer(Event::SensorEvent::Type(),
+	    Event::SensorEvent::CoalesceKey);
+	event_manager->setCoalescer(Event::TouchEvent::Type(),
+	    Event::TouchEvent::CoalesceKey);
+
+	/* allow listeners to subscribe to specific keys and buttons */
+	event_manager->setKeyFunction(Event::KeyboardEvent::Type(),
+	    Event::KeyboardEvent::SubscriptionKey);
+	event_manager->setKeyFunction(Event::JoystickButtonEvent::Type(),
+	    Event::JoystickButtonEvent::SubscriptionKey);
 
 	Graphics::Backend::Initialize();
 
@@ -213,6 +473,9 @@ Engine::Private::initialize(void)
 	Graphics::Display l_display = Graphics::Backend::Display();
 	GetBackendOverrides(l_display);
 
+	/* benchmark runs must never block on swap */
+	l_display.nowait = (bench_frames > 0);
+
 	/*
 	 * Setup
 	 */
@@ -230,8 +493,13 @@ Engine::Private::finalize(void)
 	using namespace Core;
 	using namespace Graphics;
 
+	/* queued frames reference scene meshes */
+	stopRenderThread();
+
 	_interface->finalize();
 
+	stopEventRecording();
+
 	if (event_manager)
 		event_manager->disconnect(_interface, Event::QuitEvent::Type());
 
@@ -250,6 +518,8 @@ Engine::Private::finalize(void)
 
 	delete event_manager, event_manager = 0;
 
+	Jobs::Finalize();
+
 	Platform::Finalize();
 }
 
@@ -258,6 +528,13 @@ Engine::Private::render(void)
 {
 	using namespace Event;
 
+	if (render_thread.isRunning()) {
+		renderRecord();
+		return;
+	}
+
+	MMTIME l_mark = NOW();
+
 	/*
 	 * Prepare for rendering
 	 */
@@ -267,25 +544,200 @@ Engine::Private::render(void)
 	 * Execute subclass render
 	 */
 	_interface->render();
+	l_mark = phase(FrameStats::Render, l_mark);
 
 	/*
 	 * Dispatch render event
 	 */
-	event_manager->dispatch(RenderEvent());
+	event_manager->dispatch(RenderEvent(step_clock.alpha()));
+	l_mark = phase(FrameStats::RenderDispatch, l_mark);
 
 	/*
 	 * Clean up and buffer swap
 	 */
 	Graphics::Backend::Finish();
+	phase(FrameStats::BackendFinish, l_mark);
 
 	// increase frame rate counter
 	++frame_rate;
 }
 
+/*
+ * Record frame into the free draw list and hand it over to the render
+ * thread, we only block if the render thread is still submitting the
+ * frame before the last.
+ */
+void
+Engine::Private::renderRecord(void)
+{
+	using namespace Event;
+
+	MMTIME l_mark = NOW();
+
+	render_free.wait();
+
+	Graphics::DrawList &l_list = draw_list[draw_record];
+	l_list.clear();
+	Graphics::DrawList::SetRecording(&l_list);
+
+	/*
+	 * Execute subclass render
+	 */
+	_interface->render();
+	l_mark = phase(FrameStats::Render, l_mark);
+
+	/*
+	 * Dispatch render event
+	 */
+	event_manager->dispatch(RenderEvent(step_clock.alpha()));
+	phase(FrameStats::RenderDispatch, l_mark);
+
+	Graphics::DrawList::SetRecording(0);
+
+	/* publish resource uploads to the render context */
+	Graphics::Backend::Flush();
+
+	draw_record ^= 1;
+	render_submit.post();
+
+	// increase frame rate counter
+	++frame_rate;
+}
+
+bool
+Engine::Private::startRenderThread(void)
+{
+	if (!Graphics::Backend::SupportsThreadedRender()) {
+		MMWARNING("Backend can't render from another thread, "
+		    "render thread disabled.");
+		return(false);
+	}
+
+	if (Core::Thread::HardwareConcurrency() < 2) {
+		MMWARNING("Single core system, render thread disabled.");
+		return(false);
+	}
+
+	render_quit = 0;
+	if (!render_thread.start())
+		return(false);
+
+	/* wait for the render thread to bind its context */
+	render_ready.wait();
+	if (!render_context) {
+		MMWARNING("Render context unavailable, render thread disabled.");
+		render_thread.join();
+		return(false);
+	}
+
+	return(true);
+}
+
+void
+Engine::Private::stopRenderThread(void)
+{
+	if (!render_thread.isRunning())
+		return;
+
+	Core::Atomic::CompareAndSwap(&render_quit, 0, 1);
+	render_submit.post();
+	render_thread.join();
+
+	/* reclaim draw lists still queued */
+	while (render_free.tryWait()) {}
+	while (render_submit.tryWait()) {}
+	render_free.post();
+	render_free.post();
+	draw_record = draw_submit = 0;
+}
+
+void
+Engine::Private::RenderThread(void *d)
+{
+	Private *l_p = static_cast<Private *>(d);
+
+	l_p->render_context = Graphics::Backend::AcquireRenderContext();
+	l_p->render_ready.post();
+	if (!l_p->render_context)
+		return;
+
+	for (;;) {
+		l_p->render_submit.wait();
+		if (Core::Atomic::Load(&l_p->render_quit))
+			break;
+
+		/*
+		 * Submit recorded frame and swap buffers
+		 */
+		Graphics::Painter::Render();
+		Graphics::Painter::Submit(l_p->draw_list[l_p->draw_submit]);
+		Graphics::Backend::Finish();
+
+		l_p->draw_submit ^= 1;
+		l_p->render_free.post();
+	}
+
+	Graphics::Backend::ReleaseRenderContext();
+}
+
+/*
+ * Input recording (MM_EVENT_RECORD) and replay (MM_EVENT_REPLAY), both
+ * name the recording file. Recordings are tagged with the simulation step
+ * count and replayed ahead of the same step, with a fixed step they match
+ * step by step regardless of frame timing.
+ */
+void
+Engine::Private::startEventRecording(void)
+{
+	const char *l_env;
+	if ((l_env = getenv("MM_EVENT_REPLAY"))) {
+		event_io.setFileName(l_env);
+		if (event_io.open(Core::IDataIO::ReadOnly))
+			event_player = new InputReplay(&event_io, event_manager);
+
+		if (!event_player || !event_player->isValid()) {
+			MMERROR("Unable to replay events from "
+			    << l_env << ".");
+			delete event_player, event_player = 0;
+		}
+		else MMINFO("Replaying events from " << l_env << ".");
+
+		/* recording is loaded up front */
+		event_io.close();
+	}
+	else if ((l_env = getenv("MM_EVENT_RECORD"))) {
+		event_io.setFileName(l_env);
+		if (event_io.open(Core::IDataIO::Truncate)) {
+			event_recorder =
+			    new Event::EventRecorder(&event_io, event_manager);
+			MMINFO("Recording events to " << l_env << ".");
+		}
+		else MMERROR("Unable to record events to " << l_env << ".");
+	}
+}
+
+void
+Engine::Private::stopEventRecording(void)
+{
+	delete event_player, event_player = 0;
+
+	/* flushes buffered records */
+	delete event_recorder, event_recorder = 0;
+
+	event_io.close();
+}
+
 void
 Engine::Private::second(void)
 {
 	MMDEBUG("FPS=" << frame_rate);
+	MMDEBUG("PACER: frames=" << frame_pacer.frames()
+	    << " missed=" << frame_pacer.missed()
+	    << " error=" << frame_pacer.error() * 1000. << "ms"
+	    << " error_max=" << frame_pacer.errorMax() * 1000. << "ms");
+
+	if (event_manager && event_manager->isStatsEnabled())
+		LogEventStats(*event_manager);
 
 	_interface->second();
 
@@ -296,30 +748,58 @@ Engine::Private::second(void)
 void
 Engine::Private::update(float d)
 {
+	MMTIME l_mark = NOW();
+
 	Graphics::Backend::Tick(delta_time);
+	l_mark = phase(FrameStats::BackendTick, l_mark);
 
-	/*
-	 * Tick engine features
-	 */
-	const EngineFeatureList::const_iterator l_e = features.end();
-	EngineFeatureList::const_iterator l_i;
-	for (l_i = features.begin(); l_i != l_e; ++l_i)
-		(*l_i)->tick(d);
+	tickFeatures(d);
+	l_mark = phase(FrameStats::FeatureTick, l_mark);
 
 	/*
 	 * Process events in queue
 	 */
 	if (event_manager) event_manager->execute();
+	phase(FrameStats::EventExecute, l_mark);
+
+	/*
+	 * Consume elapsed time in whole fixed steps, or a single variable
+	 * step when no fixed step is set
+	 */
+	const float l_step = step_clock.step();
+	for (int l_steps = step_clock.advance(d); l_steps > 0; --l_steps)
+		step(l_step > 0 ? l_step : d);
+}
+
+void
+Engine::Private::step(float d)
+{
+	MMTIME l_mark = NOW();
+
+	/* recorded input is keyed on the steps taken before it */
+	if (event_player) {
+		event_player->setStep(step_count);
+		if (event_player->isFinished()) {
+			MMINFO("Event replay finished.");
+			delete event_player, event_player = 0;
+		}
+	}
+
+	++step_count;
+
+	if (event_recorder) event_recorder->setStep(step_count);
 
 	/*
 	 * Execute subclass update
 	 */
 	_interface->update(d);
+	l_mark = phase(FrameStats::Update, l_mark);
 
 	/*
 	 * Dispatch update event
 	 */
 	event_manager->dispatch(Event::UpdateEvent(d));
+	phase(FrameStats::UpdateDispatch, l_mark);
 }
 
 int
@@ -333,7 +813,6 @@ Engine::Private::run(void)
 		return(-1);
 	}
 
-	float l_render = .0;
 	float l_second = .0;
 	MMTIME l_tick;
 
@@ -341,6 +820,18 @@ Engine::Private::run(void)
 		Graphics::Backend::Display();
 	MMDEBUG("VSync set to " << int(l_display.vsync));
 
+	/* pipelined rendering, submission happens on a dedicated thread */
+	const char *l_env = getenv("MM_RENDER_THREAD");
+	if (l_env && l_env[0] == '1' && startRenderThread())
+		MMINFO("Render thread started.");
+
+	/* frame pacer spin tail, time in milliseconds */
+	if ((l_env = getenv("MM_PACER_SPIN"))) {
+		float l_spin = 0;
+		sscanf(l_env, "%f", &l_spin);
+		frame_pacer.setSpin(l_spin / 1000.f);
+	}
+
 	/*
 	 * Game Loop
 	 */
@@ -350,6 +841,17 @@ Engine::Private::run(void)
 	recalculateRenderTarget();
 	l_tick = NOW() - render_target;
 
+	/* benchmark: fixed delta, render every frame, never sleep */
+	const bool l_bench = bench_frames > 0;
+	const MMTIME l_bench_start = l_tick + render_target;
+	if (l_bench)
+		MMINFO("Benchmarking " << bench_frames << " frames"
+		    " (delta " << bench_delta << "s)");
+
+	/* without vsync the pacer holds us to the frame rate limit */
+	const bool l_pace = !l_bench && l_display.vsync == 0;
+	frame_pacer.reset();
+
 	while (running) {
 		const MMTIME l_now = NOW();
 		delta_time = float(l_now - l_tick);
@@ -357,7 +859,9 @@ Engine::Private::run(void)
 
 		/* handle abnormally long delta time */
 #define DELTA_TIME_LONG_WAIT .125f
-		if (delta_time > DELTA_TIME_LONG_WAIT) {
+		if (l_bench)
+			delta_time = bench_delta;
+		else if (delta_time > DELTA_TIME_LONG_WAIT) {
 			MMWARNING("Abnormally long time between ticks, resetting!");
 			delta_time = render_target;
 		}
@@ -380,42 +884,68 @@ Engine::Private::run(void)
 		 * Rendering
 		 */
 		if (Graphics::Backend::Active()) {
-			// render if within rate limit
-			if (l_display.vsync == 0 && frame_rate_max > 0) {
-				l_render += delta_time;
-				if (l_render >= render_target) {
-					render();
-
-					// flush accumulator
-					do l_render -= render_target;
-					while (l_render >= render_target);
-				}
-			}
-
-			// render directly
-			else render();
+			render();
+			Graphics::Painter::EndFrame();
+		}
+
+		/* close frame profile */
+		frame_stats.record(FrameStats::Frame, NOW() - l_now);
+		frame_stats.commit();
+		++frame_count;
+
+		/* release frame temporaries */
+		Core::FrameArena::Instance().reset();
+
+		if (l_bench) {
+			if (frame_stats.total() >= bench_frames)
+				running = false;
+			continue;
 		}
 
 		/*
-		 * Sleep only when engine is suspended
+		 * Block on input while suspended (or sleep if the platform
+		 * can't), otherwise wait for the next frame deadline unless
+		 * vsync is doing that for us
 		 */
-		if (_interface->isSuspended())
-			Platform::Sleep(render_target * 2);
+		if (_interface->isSuspended()) {
+#define SUSPENDED_WAIT_MAX 1.
+			if (!Platform::WaitEvents(SUSPENDED_WAIT_MAX))
+				Platform::Sleep(render_target * 2);
+			frame_pacer.reset();
+		}
+		else if (l_pace)
+			frame_pacer.wait();
 	}
 
 	/*
 	 * Exit
 	 */
 
+	if (l_bench)
+		LogBenchmark(frame_stats, feature_schedule,
+		    NOW() - l_bench_start);
+
 	finalize();
 	return(exit_code);
 }
 
+void
+Engine::Private::tickFeatures(float d)
+{
+	if (features_dirty) {
+		feature_schedule.build(features);
+		features_dirty = false;
+	}
+
+	feature_schedule.tick(d);
+}
+
 void
 Engine::Private::addFeature(Game::IEngineFeature *f)
 {
 	assert(f && "Invalid feature!");
 	features.push_back(f);
+	features_dirty = true;
 }
 
 void
@@ -423,6 +953,7 @@ Engine::Private::removeFeature(Game::IEngineFeature *f)
 {
 	assert(f && "Invalid feature!");
 	features.remove(f);
+	features_dirty = true;
 }
 
 Game::IEngineFeature *
@@ -451,6 +982,15 @@ void
 Engine::Private::recalculateRenderTarget()
 {
 	render_target = 1.f/(frame_rate_max ? frame_rate_max : 60.f);
+	frame_pacer.setPeriod(frame_rate_max ? render_target : 0);
+}
+
+MMTIME
+Engine::Private::phase(FrameStats::Phase p, MMTIME start)
+{
+	const MMTIME l_now = NOW();
+	frame_stats.record(p, l_now - start);
+	return(l_now);
 }
 
 Engine::Engine(void)
@@ -509,6 +1049,48 @@ Engine::frameRate(void) const
 	return(PIMPL->frame_rate);
 }
 
+const Game::FrameStats &
+Engine::frameStats(void) const
+{
+	return(PIMPL->frame_stats);
+}
+
+MMTIME
+Engine::featureTime(const Core::Type &t) const
+{
+	return(PIMPL->feature_schedule.time(t));
+}
+
+const Game::FramePacer &
+Engine::framePacer(void) const
+{
+	return(PIMPL->frame_pacer);
+}
+
+void
+Engine::setFixedStep(float s)
+{
+	PIMPL->step_clock.setStep(s);
+}
+
+float
+Engine::fixedStep(void) const
+{
+	return(PIMPL->step_clock.step());
+}
+
+uint32_t
+Engine::stepCount(void) const
+{
+	return(PIMPL->step_count);
+}
+
+float
+Engine::interpolation(void) const
+{
+	return(PIMPL->step_clock.alpha());
+}
+
 unsigned short Engine::frameRateMax(void) const
 {
 	return(PIMPL->frame_rate_max);
@@ -532,6 +1114,7 @@ Engine::stop(int ec)
 	MMINFO("Engine stopped.");
 	PIMPL->exit_code = ec;
 	PIMPL->running = false;
+	Core::Platform::Wake();
 }
 
 void
@@ -546,6 +1129,7 @@ Engine::resume(void)
 {
 	MMINFO("Engine resumed.");
 	PIMPL->suspended = false;
+	Core::Platform::Wake();
 }
 
 Event::EventManager *
@@ -42,15 +42,18 @@
 #include "core/logger.h"
 #include "core/type.h"
 
+#include "game/entityscenelayer.h"
 #include "game/factory.h"
 #include "game/icomponent.h"
 
 #include <list>
+#include <vector>
 
 MARSHMALLOW_NAMESPACE_BEGIN
 namespace Game { /******************************************** Game Namespace */
 namespace { /************************************ Game::<anonymous> Namespace */
 	typedef std::list<IComponent *> ComponentList;
+	typedef std::vector<IComponent *> ComponentSlots;
 } /********************************************** Game::<anonymous> Namespace */
 
 struct Entity::Private
@@ -78,6 +81,9 @@ struct Entity::Private
 	inline Game::IComponent *
 	getComponentType(const Core::Type &type) const;
 
+	inline void
+	refreshSlot(const Core::Type &type);
+
 	inline void
 	render(void);
 
@@ -85,6 +91,7 @@ struct Entity::Private
 	update(float delta);
 
 	Game::ComponentList components;
+	Game::ComponentSlots slots;
 	Core::Identifier id;
 	Game::EntitySceneLayer *layer;
 	bool killed;
@@ -92,9 +99,11 @@ struct Entity::Private
 
 Entity::Private::~Private()
 {
-	/* free components */
+	/* free components, pooled ones go back to the layer */
 	while (!components.empty()) {
-		delete components.back();
+		IComponent *l_component = components.back();
+		if (!layer || !layer->releaseComponent(l_component))
+			delete l_component;
 		components.pop_back();
 	}
 }
@@ -103,12 +112,20 @@ void
 Entity::Private::addComponent(IComponent *c)
 {
 	components.push_back(c);
+
+	/* first component of a type wins, same as a list walk */
+	const size_t l_index = static_cast<size_t>(c->type().index());
+	if (slots.size() <= l_index)
+		slots.resize(l_index + 1, 0);
+	if (!slots[l_index])
+		slots[l_index] = c;
 }
 
 void
 Entity::Private::removeComponent(IComponent *c)
 {
 	components.remove(c);
+	refreshSlot(c->type());
 }
 
 IComponent *
@@ -123,6 +140,7 @@ Entity::Private::removeComponent(const Core::Identifier &i)
 		if ((*l_i)->id() == i) {
 			l_component = *l_i;
 			components.remove(l_component);
+			refreshSlot(l_component->type());
 			break;
 		}
 
@@ -145,14 +163,27 @@ Entity::Private::getComponent(const Core::Identifier &i) const
 IComponent *
 Entity::Private::getComponentType(const Core::Type &t) const
 {
+	const size_t l_index = static_cast<size_t>(t.index());
+	return(l_index < slots.size() ? slots[l_index] : 0);
+}
+
+void
+Entity::Private::refreshSlot(const Core::Type &t)
+{
+	const size_t l_index = static_cast<size_t>(t.index());
+	if (l_index >= slots.size())
+		return;
+
 	ComponentList::const_iterator l_i;
 	ComponentList::const_iterator l_c = components.end();
 
-	for (l_i = components.begin(); l_i != l_c; ++l_i) {
-		if ((*l_i)->type() == t)
-			return(*l_i);
-	}
-	return(0);
+	/* fall back to the next component of the same type, if any */
+	slots[l_index] = 0;
+	for (l_i = components.begin(); l_i != l_c; ++l_i)
+		if ((*l_i)->type() == t) {
+			slots[l_index] = *l_i;
+			break;
+		}
 }
 
 void
@@ -189,6 +220,18 @@ Entity::~Entity(void)
 	PIMPL_DESTROY;
 }
 
+void
+Entity::reset(void)
+{
+	ComponentList::const_iterator l_i;
+	ComponentList::const_iterator l_c = PIMPL->components.end();
+
+	for (l_i = PIMPL->components.begin(); l_i != l_c; ++l_i)
+		(*l_i)->reset();
+
+	PIMPL->killed = false;
+}
+
 const Core::Identifier &
 Entity::id(void) const
 {
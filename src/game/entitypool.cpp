@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#include "game/entitypool.h"
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+#include "core/identifier.h"
+#include "core/logger.h"
+#include "core/type.h"
+
+#include "game/entity.h"
+#include "game/entityscenelayer.h"
+#include "game/factory.h"
+#include "game/icomponent.h"
+
+#include <vector>
+
+MARSHMALLOW_NAMESPACE_BEGIN
+namespace Game { /******************************************** Game Namespace */
+namespace { /************************************ Game::<anonymous> Namespace */
+	struct ComponentSpec
+	{
+		ComponentSpec(const Core::Type &t, const Core::Identifier &i)
+		    : type(t)
+		    , id(i)
+		{}
+
+		Core::Type type;
+		Core::Identifier id;
+	};
+	typedef std::vector<ComponentSpec> ComponentSpecList;
+} /********************************************** Game::<anonymous> Namespace */
+
+struct EntityPool::Private
+{
+	Private(const Core::Identifier &i, Game::EntitySceneLayer *l)
+	    : id(i)
+	    , layer(l)
+	    , available(0)
+	    , size(0)
+	{}
+
+	~Private();
+
+	inline void
+	construct(void);
+
+	ComponentSpecList components;
+	EntityList free;
+	Core::Identifier id;
+	Game::EntitySceneLayer *layer;
+	size_t available;
+	size_t size;
+};
+
+EntityPool::Private::~Private()
+{
+	/* free dormant entities */
+	while (!free.empty()) {
+		delete free.back();
+		free.pop_back();
+	}
+}
+
+void
+EntityPool::Private::construct(void)
+{
+	const IFactory *l_factory = Factory::Instance();
+	Entity *l_entity = new Entity(id, layer);
+
+	ComponentSpecList::const_iterator l_i;
+	for (l_i = components.begin(); l_i != components.end(); ++l_i) {
+		IComponent *l_component = 0;
+		if (l_factory)
+			l_component = l_factory->
+			    createComponent(l_i->type, l_i->id, l_entity);
+		if (!l_component) {
+			MMWARNING("Failed to create pooled component '"
+			    << l_i->type.str() << "'.");
+			continue;
+		}
+		l_entity->addComponent(l_component);
+	}
+
+	free.push_back(l_entity);
+	++available;
+	++size;
+}
+
+EntityPool::EntityPool(const Core::Identifier &i, Game::EntitySceneLayer *l)
+    : PIMPL_CREATE_X(i, l)
+{
+}
+
+EntityPool::~EntityPool(void)
+{
+	PIMPL_DESTROY;
+}
+
+void
+EntityPool::addComponent(const Core::Type &t, const Core::Identifier &i)
+{
+	PIMPL->components.push_back(ComponentSpec(t, i));
+}
+
+void
+EntityPool::reserve(size_t c)
+{
+	while (PIMPL->available < c)
+		PIMPL->construct();
+}
+
+Game::Entity *
+EntityPool::acquire(void)
+{
+	if (!PIMPL->available)
+		PIMPL->construct();
+
+	Entity *l_entity = static_cast<Entity *>(PIMPL->free.front());
+	PIMPL->layer->adoptEntity(PIMPL->free, this);
+	--PIMPL->available;
+	return(l_entity);
+}
+
+void
+EntityPool::release(Game::IEntity *e)
+{
+	/* only entities acquired from this pool are expected */
+	if (!PIMPL->layer->abandonEntity(e, PIMPL->free)) {
+		MMWARNING("Released entity isn't in the layer! Ignoring.");
+		return;
+	}
+
+	/* most recently released goes first, it's still warm in cache */
+	PIMPL->free.splice(PIMPL->free.begin(), PIMPL->free,
+	    --PIMPL->free.end());
+
+	static_cast<Entity *>(e)->reset();
+	++PIMPL->available;
+}
+
+size_t
+EntityPool::available(void) const
+{
+	return(PIMPL->available);
+}
+
+size_t
+EntityPool::size(void) const
+{
+	return(PIMPL->size);
+}
+
+Game::EntitySceneLayer *
+EntityPool::layer(void) const
+{
+	return(PIMPL->layer);
+}
+
+} /*********************************************************** Game Namespace */
+MARSHMALLOW_NAMESPACE_END
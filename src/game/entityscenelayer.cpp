@@ -38,33 +38,90 @@
  * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
  */
 
+#include "core/hashtable_p.h"
 #include "core/identifier.h"
 #include "core/logger.h"
 #include "core/type.h"
 
 #include "graphics/camera.h"
 
+#include "game/entitypool.h"
 #include "game/factory.h"
+#include "game/icomponent.h"
+#include "game/icomponentpool.h"
 #include "game/ientity.h"
 #include "game/positioncomponent.h"
 #include "game/sizecomponent.h"
 
+#include <map>
+#include <vector>
+
 MARSHMALLOW_NAMESPACE_BEGIN
 namespace Game { /******************************************** Game Namespace */
+namespace { /************************************ Game::<anonymous> Namespace */
+	typedef std::map<MMUID, IComponentPool *> ComponentPoolMap;
+	typedef std::vector<EntityPool *> EntityPoolList;
+
+	/* entities sharing an identifier are chained in list order */
+	struct EntityNode
+	{
+		EntityNode(void)
+		    : prev(0)
+		    , next(0)
+		{}
+
+		EntityList::iterator node;
+		IEntity *prev;
+		IEntity *next;
+	};
+
+	/* first and last entity (in list order) holding an identifier */
+	struct EntityRef
+	{
+		EntityRef(void)
+		    : first(0)
+		    , last(0)
+		{}
+
+		IEntity *first;
+		IEntity *last;
+	};
+
+	typedef Core::HashTable<MMUID, EntityRef> EntityIdIndex;
+	typedef Core::HashTable<const IEntity *, EntityNode> EntityPtrIndex;
+	typedef Core::HashTable<const IEntity *, EntityPool *> EntityPoolIndex;
+} /********************************************** Game::<anonymous> Namespace */
 
 struct EntitySceneLayer::Private
 {
 	Private()
-	    : visiblility_testing(false)
+	    : reclaimed(0)
+	    , reclaimed_frame(0)
+	    , visiblility_testing(false)
 	{}
 
 	~Private();
 
+	inline bool
+	indexed(const Game::IEntity *entity);
+
+	inline void
+	index(Game::IEntity *entity, EntityList::iterator node);
+
+	inline bool
+	unindex(Game::IEntity *entity, EntityList::iterator &node);
+
+	inline void
+	addEntity(Game::IEntity *entity);
+
+	inline bool
+	removeEntity(Game::IEntity *entity);
+
 	inline Game::IEntity *
 	removeEntity(const Core::Identifier &identifier);
 
 	inline Game::IEntity *
-	getEntity(const Core::Identifier &identifier) const;
+	getEntity(const Core::Identifier &identifier);
 
 	inline void
 	render(void);
@@ -72,7 +129,17 @@ struct EntitySceneLayer::Private
 	inline void
 	update(float delta);
 
+	inline void
+	reclaim(void);
+
 	EntityList entities;
+	EntityIdIndex by_id;
+	EntityPtrIndex by_entity;
+	EntityPoolIndex pooled;
+	EntityPoolList entity_pools;
+	ComponentPoolMap pools;
+	size_t reclaimed;
+	size_t reclaimed_frame;
 	bool visiblility_testing;
 };
 
@@ -83,41 +150,109 @@ EntitySceneLayer::Private::~Private()
 		delete entities.back();
 		entities.pop_back();
 	}
+
+	/* free entity pools, dormant entities release their components */
+	while (!entity_pools.empty()) {
+		delete entity_pools.back();
+		entity_pools.pop_back();
+	}
+
+	/* free component pools, after entities released their components */
+	ComponentPoolMap::const_iterator l_i;
+	for (l_i = pools.begin(); l_i != pools.end(); ++l_i)
+		delete l_i->second;
+	pools.clear();
 }
 
-Game::IEntity *
-EntitySceneLayer::Private::removeEntity(const Core::Identifier &i)
+bool
+EntitySceneLayer::Private::indexed(const Game::IEntity *e)
 {
-	Game::IEntity *l_entity = 0;
+	return(by_entity.find(e) != 0);
+}
 
-	EntityList::const_iterator l_i;
-	EntityList::const_iterator l_c = entities.end();
-
-	/* maybe replace later with a map if required */
-	for (l_i = entities.begin(); l_i != l_c; ++l_i) {
-		if ((*l_i)->id() == i) {
-			l_entity = *l_i;
-			entities.remove(*l_i);
-			break;
-		}
+void
+EntitySceneLayer::Private::index(Game::IEntity *e, EntityList::iterator n)
+{
+	EntityNode &l_node = by_entity.insert(e);
+	l_node.node = n;
+
+	/* append to the identifier chain, entities only join at list end */
+	EntityRef &l_ref = by_id.insert(e->id().uid());
+	l_node.prev = l_ref.last;
+	if (l_ref.last)
+		by_entity.find(l_ref.last)->next = e;
+	else
+		l_ref.first = e;
+	l_ref.last = e;
+}
+
+bool
+EntitySceneLayer::Private::unindex(Game::IEntity *e, EntityList::iterator &n)
+{
+	EntityNode *l_node = by_entity.find(e);
+	if (!l_node)
+		return(false);
+
+	n = l_node->node;
+	IEntity *l_prev = l_node->prev;
+	IEntity *l_next = l_node->next;
+	by_entity.erase(e);
+	pooled.erase(e);
+
+	/* unlink from the identifier chain */
+	if (l_prev)
+		by_entity.find(l_prev)->next = l_next;
+	if (l_next)
+		by_entity.find(l_next)->prev = l_prev;
+
+	const MMUID l_uid = e->id().uid();
+	EntityRef *l_ref = by_id.find(l_uid);
+	if (l_ref->first == e)
+		l_ref->first = l_next;
+	if (l_ref->last == e)
+		l_ref->last = l_prev;
+	if (!l_ref->first)
+		by_id.erase(l_uid);
+
+	return(true);
+}
+
+void
+EntitySceneLayer::Private::addEntity(Game::IEntity *e)
+{
+	if (indexed(e)) {
+		MMWARNING("Entity already in layer! Ignoring.");
+		return;
 	}
 
-	return(l_entity);
+	index(e, entities.insert(entities.end(), e));
 }
 
-Game::IEntity *
-EntitySceneLayer::Private::getEntity(const Core::Identifier &i) const
+bool
+EntitySceneLayer::Private::removeEntity(Game::IEntity *e)
 {
-	EntityList::const_iterator l_i;
-	EntityList::const_iterator l_c = entities.end();
+	EntityList::iterator l_i;
+	if (!unindex(e, l_i))
+		return(false);
 
-	/* maybe replace later with a map if required */
-	for (l_i = entities.begin(); l_i != l_c; ++l_i) {
-		if ((*l_i)->id() == i)
-			return(*l_i);
-	}
+	entities.erase(l_i);
+	return(true);
+}
 
-	return(0);
+Game::IEntity *
+EntitySceneLayer::Private::removeEntity(const Core::Identifier &i)
+{
+	Game::IEntity *l_entity = getEntity(i);
+	if (l_entity)
+		removeEntity(l_entity);
+	return(l_entity);
+}
+
+Game::IEntity *
+EntitySceneLayer::Private::getEntity(const Core::Identifier &i)
+{
+	EntityRef *l_ref = by_id.find(i.uid());
+	return(l_ref ? l_ref->first : 0);
 }
 
 void
@@ -125,6 +260,10 @@ EntitySceneLayer::Private::render(void)
 {
 	EntityList::const_iterator l_i;
 
+	/* render closes the frame for reclaim statistics */
+	reclaimed = reclaimed_frame;
+	reclaimed_frame = 0;
+
 	if (visiblility_testing) {
 		const Math::Point2 &l_camera_pos = Graphics::Camera::Position();
 		const float l_visiblility_radius2 = Graphics::Camera::VisibleMagnitude2();
@@ -168,17 +307,37 @@ EntitySceneLayer::Private::update(float d)
 {
 	EntityList::const_iterator l_i;
 
-	for (l_i = entities.begin(); l_i != entities.end();) {
-		IEntity *l_entity = (*l_i++);
+	for (l_i = entities.begin(); l_i != entities.end(); ++l_i)
+		if (!(*l_i)->isZombie()) (*l_i)->update(d);
 
-		if (l_entity->isZombie()) {
-			entities.remove(l_entity);
+	/* entities killed during this update are gone before render */
+	reclaim();
+}
+
+void
+EntitySceneLayer::Private::reclaim(void)
+{
+	EntityList::iterator l_i = entities.begin();
+
+	/* single sweep, list order of survivors is kept */
+	while (l_i != entities.end()) {
+		IEntity *l_entity = *l_i++;
+
+		if (!l_entity->isZombie())
+			continue;
+
+		/* pooled entities go back to their pool */
+		EntityPool **l_pool = pooled.find(l_entity);
+		if (l_pool)
+			(*l_pool)->release(l_entity);
+		else {
+			removeEntity(l_entity);
 			delete l_entity;
 		}
-		else
-			l_entity->update(d);
+		++reclaimed_frame;
 	}
 }
+
 EntitySceneLayer::EntitySceneLayer(const Core::Identifier &i,
                                    Game::IScene *s,
                                    int f)
@@ -195,7 +354,7 @@ EntitySceneLayer::~EntitySceneLayer(void)
 void
 EntitySceneLayer::addEntity(Game::IEntity *e)
 {
-	PIMPL->entities.push_back(e);
+	PIMPL->addEntity(e);
 }
 
 Game::IEntity *
@@ -207,7 +366,7 @@ EntitySceneLayer::removeEntity(const Core::Identifier &i)
 void
 EntitySceneLayer::removeEntity(Game::IEntity *e)
 {
-	PIMPL->entities.remove(e);
+	PIMPL->removeEntity(e);
 }
 
 Game::IEntity *
@@ -222,6 +381,80 @@ EntitySceneLayer::getEntities(void) const
 	return(PIMPL->entities);
 }
 
+void
+EntitySceneLayer::adoptEntity(EntityList &l, Game::EntityPool *p)
+{
+	if (l.empty())
+		return;
+
+	Game::IEntity *l_entity = l.front();
+	if (PIMPL->indexed(l_entity)) {
+		MMWARNING("Entity already in layer! Ignoring.");
+		return;
+	}
+
+	PIMPL->entities.splice(PIMPL->entities.end(), l, l.begin());
+	PIMPL->index(l_entity, --PIMPL->entities.end());
+
+	if (p)
+		PIMPL->pooled.insert(l_entity) = p;
+}
+
+bool
+EntitySceneLayer::abandonEntity(Game::IEntity *e, EntityList &l)
+{
+	EntityList::iterator l_i;
+	if (!PIMPL->unindex(e, l_i))
+		return(false);
+
+	l.splice(l.end(), PIMPL->entities, l_i);
+	return(true);
+}
+
+void
+EntitySceneLayer::addEntityPool(Game::EntityPool *p)
+{
+	PIMPL->entity_pools.push_back(p);
+}
+
+void
+EntitySceneLayer::addComponentPool(Game::IComponentPool *p)
+{
+	const MMUID l_uid = p->type().uid();
+
+	if (PIMPL->pools.find(l_uid) != PIMPL->pools.end()) {
+		MMERROR("Component pool for type already registered! "
+		        "Ignoring.");
+		delete p;
+		return;
+	}
+
+	PIMPL->pools[l_uid] = p;
+}
+
+Game::IComponentPool *
+EntitySceneLayer::componentPool(const Core::Type &t) const
+{
+	ComponentPoolMap::const_iterator l_i = PIMPL->pools.find(t.uid());
+	return(l_i != PIMPL->pools.end() ? l_i->second : 0);
+}
+
+bool
+EntitySceneLayer::releaseComponent(Game::IComponent *c)
+{
+	if (PIMPL->pools.empty())
+		return(false);
+
+	IComponentPool *l_pool = componentPool(c->type());
+	return(l_pool && l_pool->release(c));
+}
+
+size_t
+EntitySceneLayer::reclaimed(void) const
+{
+	return(PIMPL->reclaimed);
+}
+
 bool
 EntitySceneLayer::visiblityTesting(void) const
 {
@@ -42,14 +42,19 @@
 
 #include "graphics/quadmesh.h"
 
+#include "game/animationcomponent.h"
 #include "game/entity.h"
 #include "game/entityscenelayer.h"
+#include "game/icomponentpool.h"
 #include "game/movementcomponent.h"
 #include "game/pausescenelayer.h"
 #include "game/positioncomponent.h"
 #include "game/rendercomponent.h"
 #include "game/scene.h"
+#include "game/sizecomponent.h"
 #include "game/splashscenelayer.h"
+#include "game/textcomponent.h"
+#include "game/tilesetcomponent.h"
 
 #if MARSHMALLOW_WITH_BOX2D
 #   include "game/box2d/box2dcomponent.h"
@@ -108,9 +113,18 @@ Factory::createComponent(const Core::Type &t,
                          const Core::Identifier &i,
                          Game::IEntity *e) const
 {
+	/* layer pooling this component type */
+	Game::EntitySceneLayer *l_layer = e ? e->layer() : 0;
+	if (IComponentPool *l_pool = l_layer ? l_layer->componentPool(t) : 0)
+		return(l_pool->create(i, e));
+
 	if (t == MovementComponent::Type()) return(new MovementComponent(i, e));
 	else if (t == RenderComponent::Type()) return(new RenderComponent(i, e));
 	else if (t == PositionComponent::Type()) return(new PositionComponent(i, e));
+	else if (t == AnimationComponent::Type()) return(new AnimationComponent(i, e));
+	else if (t == SizeComponent::Type()) return(new SizeComponent(i, e));
+	else if (t == TextComponent::Type()) return(new TextComponent(i, e));
+	else if (t == TilesetComponent::Type()) return(new TilesetComponent(i, e));
 #if MARSHMALLOW_WITH_BOX2D
 	else if (t == Box2DComponent::Type()) return(new Box2DComponent(i, e));
 #endif
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#include "game/featureschedule_p.h"
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+#include "core/jobs.h"
+#include "core/logger.h"
+#include "core/platform.h"
+#include "core/type.h"
+
+#include "game/ienginefeature.h"
+
+#include <algorithm>
+#include <vector>
+
+MARSHMALLOW_NAMESPACE_BEGIN
+namespace Game { /******************************************** Game Namespace */
+
+namespace {
+
+	bool
+	SlotLevelLess(const FeatureSchedule::Slot &a,
+	    const FeatureSchedule::Slot &b)
+	{
+		return(a.level < b.level);
+	}
+
+	void
+	TickSlot(void *data)
+	{
+		FeatureSchedule::Slot &l_slot =
+		    *static_cast<FeatureSchedule::Slot *>(data);
+		const MMTIME l_start = NOW();
+
+		l_slot.feature->tick(l_slot.delta);
+
+		l_slot.time = NOW() - l_start;
+		l_slot.time_total += l_slot.time;
+		if (l_slot.time > l_slot.time_max)
+			l_slot.time_max = l_slot.time;
+		++l_slot.ticks;
+	}
+
+} // namespace
+
+struct FeatureSchedule::Private
+{
+	std::vector<Slot> slots;
+};
+
+FeatureSchedule::FeatureSchedule(void)
+    : PIMPL_CREATE
+{
+}
+
+FeatureSchedule::~FeatureSchedule(void)
+{
+	PIMPL_DESTROY;
+}
+
+bool
+FeatureSchedule::build(const EngineFeatureList &features)
+{
+	std::vector<Slot> &l_slots = PIMPL->slots;
+	l_slots.clear();
+	l_slots.reserve(features.size());
+
+	const EngineFeatureList::const_iterator l_e = features.end();
+	EngineFeatureList::const_iterator l_i;
+	for (l_i = features.begin(); l_i != l_e; ++l_i) {
+		Slot l_slot;
+		l_slot.feature = *l_i;
+		l_slot.time = l_slot.time_total = l_slot.time_max = 0;
+		l_slot.ticks = 0;
+		l_slot.delta = 0;
+		l_slot.level = 0;
+		l_slot.worker = false;
+		l_slots.push_back(l_slot);
+	}
+
+	/*
+	 * A feature's level is one above that of its deepest dependency,
+	 * it settles within one pass per feature unless there is a cycle.
+	 */
+	const size_t l_count = l_slots.size();
+	bool l_changed = true;
+	for (size_t l_pass = 0; l_changed && l_pass <= l_count; ++l_pass) {
+		l_changed = false;
+		for (size_t i = 0; i < l_count; ++i) {
+			Slot &l_slot = l_slots[i];
+			for (size_t j = 0; j < l_count; ++j) {
+				const Slot &l_dep = l_slots[j];
+				const Core::Type &l_type = l_dep.feature->type();
+				if (i == j || l_slot.level > l_dep.level
+				    || !l_slot.feature->dependsOn(l_type))
+					continue;
+				l_slot.level = l_dep.level + 1;
+				l_changed = true;
+			}
+		}
+	}
+	if (l_changed)
+		MMERROR("Engine feature dependency cycle detected!");
+
+	std::stable_sort(l_slots.begin(), l_slots.end(), SlotLevelLess);
+
+	/* workers only where there is something to overlap with */
+	size_t l_begin = 0;
+	while (l_begin < l_count) {
+		size_t l_end = l_begin + 1;
+		while (l_end < l_count
+		    && l_slots[l_end].level == l_slots[l_begin].level)
+			++l_end;
+
+		if (l_end - l_begin > 1)
+			for (size_t i = l_begin; i < l_end; ++i)
+				l_slots[i].worker =
+				    (IEngineFeature::AnyThread ==
+				     l_slots[i].feature->affinity());
+
+		l_begin = l_end;
+	}
+
+	return(!l_changed);
+}
+
+void
+FeatureSchedule::tick(float d)
+{
+	using namespace Core;
+
+	std::vector<Slot> &l_slots = PIMPL->slots;
+	const size_t l_count = l_slots.size();
+	const bool l_jobs = Jobs::Workers() > 0;
+
+	size_t l_begin = 0;
+	while (l_begin < l_count) {
+		const int l_level = l_slots[l_begin].level;
+		Jobs::Counter l_counter;
+		bool l_fanned = false;
+		size_t l_end;
+
+		for (l_end = l_begin;
+		     l_end < l_count && l_slots[l_end].level == l_level;
+		     ++l_end) {
+			Slot &l_slot = l_slots[l_end];
+			l_slot.delta = d;
+			if (l_jobs && l_slot.worker) {
+				Jobs::Run(TickSlot, &l_slot, &l_counter);
+				l_fanned = true;
+			}
+		}
+
+		for (size_t i = l_begin; i < l_end; ++i)
+			if (!l_jobs || !l_slots[i].worker)
+				TickSlot(&l_slots[i]);
+
+		if (l_fanned)
+			Jobs::Wait(l_counter);
+
+		l_begin = l_end;
+	}
+}
+
+size_t
+FeatureSchedule::size(void) const
+{
+	return(PIMPL->slots.size());
+}
+
+const FeatureSchedule::Slot &
+FeatureSchedule::slot(size_t i) const
+{
+	return(PIMPL->slots[i]);
+}
+
+MMTIME
+FeatureSchedule::time(const Core::Type &t) const
+{
+	const std::vector<Slot> &l_slots = PIMPL->slots;
+	for (size_t i = 0; i < l_slots.size(); ++i)
+		if (l_slots[i].feature->type() == t)
+			return(l_slots[i].time);
+	return(0);
+}
+
+} /*********************************************************** Game Namespace */
+MARSHMALLOW_NAMESPACE_END
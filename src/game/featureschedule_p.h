@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#pragma once
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+#ifndef MARSHMALLOW_GAME_FEATURESCHEDULE_P_H
+#define MARSHMALLOW_GAME_FEATURESCHEDULE_P_H 1
+
+#include <core/environment.h>
+#include <core/global.h>
+#include <core/namespace.h>
+
+#include <list>
+
+MARSHMALLOW_NAMESPACE_BEGIN
+namespace Core { /******************************************** Core Namespace */
+	class Type;
+} /*********************************************************** Core Namespace */
+
+namespace Game { /******************************************** Game Namespace */
+
+	struct IEngineFeature;
+	typedef std::list<IEngineFeature *> EngineFeatureList;
+
+/**** IMPLEMENTATION NOTES *****************************************************
+ *
+ *  Features are grouped in levels, a feature's level is one above that of
+ *  its deepest dependency. Features on the same level don't depend on each
+ *  other and each level waits on the previous one.
+ *
+ *  Only levels where two or more features can overlap are worth a trip
+ *  through the job scheduler, any thread features sharing a level with
+ *  others are marked as workers and get ticked as jobs while the rest of
+ *  the level is ticked by the calling thread. Everything else, including
+ *  a lone any thread feature, is ticked inline.
+ *
+ */
+
+	/*! @brief Engine Feature Tick Schedule */
+	class MARSHMALLOW_GAME_EXPORT
+	FeatureSchedule
+	{
+		PRIVATE_IMPLEMENTATION
+		NO_ASSIGN_COPY(FeatureSchedule);
+	public:
+
+		struct Slot
+		{
+			IEngineFeature *feature;
+			MMTIME   time;
+			MMTIME   time_total;
+			MMTIME   time_max;
+			uint32_t ticks;
+			float    delta;
+			int      level;
+			bool     worker;
+		};
+
+	public:
+
+		FeatureSchedule(void);
+		~FeatureSchedule(void);
+
+		/*!
+		 * @brief Schedule features, dropping previous timings
+		 * @return False if a dependency cycle was found
+		 */
+		bool build(const EngineFeatureList &features);
+
+		/*! @brief Tick every feature in dependency order */
+		void tick(float delta);
+
+		/*! @brief Number of features scheduled */
+		size_t size(void) const;
+
+		/*! @brief Scheduled features, sorted by level */
+		const Slot & slot(size_t index) const;
+
+		/*! @brief Last tick time of a feature type, zero if unknown */
+		MMTIME time(const Core::Type &type) const;
+	};
+
+} /*********************************************************** Game Namespace */
+MARSHMALLOW_NAMESPACE_END
+
+#endif
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#include "game/framepacer.h"
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+#include "core/platform.h"
+#include "core/thread.h"
+
+MARSHMALLOW_NAMESPACE_BEGIN
+namespace Game { /******************************************** Game Namespace */
+
+struct FramePacer::Private
+{
+	Private(MMTIME p, MMTIME s)
+	    : period(p > 0 ? p : 0)
+	    , spin(s > 0 ? s : 0)
+	    , deadline(NOW())
+	    , error(0)
+	    , error_max(0)
+	    , slept(0)
+	    , spun(0)
+	    , frames(0)
+	    , missed(0)
+	{}
+
+	MMTIME period;
+	MMTIME spin;
+	MMTIME deadline;
+	MMTIME error;
+	MMTIME error_max;
+	MMTIME slept;
+	MMTIME spun;
+	uint32_t frames;
+	uint32_t missed;
+};
+
+FramePacer::FramePacer(MMTIME p, MMTIME s)
+    : PIMPL_CREATE_X(p, s)
+{
+}
+
+FramePacer::~FramePacer(void)
+{
+	PIMPL_DESTROY;
+}
+
+MMTIME
+FramePacer::period(void) const
+{
+	return(PIMPL->period);
+}
+
+void
+FramePacer::setPeriod(MMTIME p)
+{
+	PIMPL->period = p > 0 ? p : 0;
+	reset();
+}
+
+MMTIME
+FramePacer::spin(void) const
+{
+	return(PIMPL->spin);
+}
+
+void
+FramePacer::setSpin(MMTIME s)
+{
+	PIMPL->spin = s > 0 ? s : 0;
+}
+
+void
+FramePacer::reset(void)
+{
+	PIMPL->deadline = NOW();
+}
+
+void
+FramePacer::wait(void)
+{
+	using namespace Core;
+
+	if (PIMPL->period <= 0)
+		return;
+
+	++PIMPL->frames;
+	PIMPL->deadline += PIMPL->period;
+
+	MMTIME l_now = NOW();
+	if (l_now >= PIMPL->deadline) {
+		++PIMPL->missed;
+
+		/* over a frame behind, don't try to catch up */
+		if (l_now - PIMPL->deadline >= PIMPL->period)
+			PIMPL->deadline = l_now;
+		return;
+	}
+
+	/*
+	 * Sleep through most of the wait, sleeps overshoot by a scheduler
+	 * quantum or so, then spin out the remainder.
+	 */
+	const MMTIME l_sleep = PIMPL->deadline - l_now - PIMPL->spin;
+	if (l_sleep > 0) {
+		Platform::Sleep(l_sleep);
+		const MMTIME l_woke = NOW();
+		PIMPL->slept += l_woke - l_now;
+		l_now = l_woke;
+	}
+
+	const MMTIME l_spin = l_now;
+	while (l_now < PIMPL->deadline) {
+		Thread::Relinquish();
+		l_now = NOW();
+	}
+	PIMPL->spun += l_now - l_spin;
+
+	const MMTIME l_error = l_now - PIMPL->deadline;
+	PIMPL->error += l_error;
+	if (l_error > PIMPL->error_max)
+		PIMPL->error_max = l_error;
+}
+
+uint32_t
+FramePacer::frames(void) const
+{
+	return(PIMPL->frames);
+}
+
+uint32_t
+FramePacer::missed(void) const
+{
+	return(PIMPL->missed);
+}
+
+MMTIME
+FramePacer::error(void) const
+{
+	const uint32_t l_hit = PIMPL->frames - PIMPL->missed;
+	return(l_hit ? PIMPL->error / l_hit : 0);
+}
+
+MMTIME
+FramePacer::errorMax(void) const
+{
+	return(PIMPL->error_max);
+}
+
+MMTIME
+FramePacer::slept(void) const
+{
+	return(PIMPL->slept);
+}
+
+MMTIME
+FramePacer::spun(void) const
+{
+	return(PIMPL->spun);
+}
+
+void
+FramePacer::resetStats(void)
+{
+	PIMPL->error = PIMPL->error_max = 0;
+	PIMPL->slept = PIMPL->spun = 0;
+	PIMPL->frames = PIMPL->missed = 0;
+}
+
+} /*********************************************************** Game Namespace */
+MARSHMALLOW_NAMESPACE_END
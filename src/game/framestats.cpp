@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#include "game/framestats.h"
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+MARSHMALLOW_NAMESPACE_BEGIN
+namespace Game { /******************************************** Game Namespace */
+
+/*
+ * Samples are stored phase-major (one ring per phase), the current frame is
+ * accumulated separately and only copied into the rings on commit().
+ */
+struct FrameStats::Private
+{
+	Private(size_t c)
+	    : capacity(c > 0 ? c : 1)
+	    , samples(capacity * Phases, 0)
+	    , head(0)
+	    , frames(0)
+	    , total(0)
+	{
+		scratch.reserve(capacity);
+		std::fill(current, current + Phases, 0);
+	}
+
+	inline const MMTIME * ring(Phase phase) const
+	    { return(&samples[phase * capacity]); }
+
+	inline size_t last(void) const
+	    { return((head + capacity - 1) % capacity); }
+
+	size_t capacity;
+	std::vector<MMTIME> samples;
+	mutable std::vector<MMTIME> scratch;
+	MMTIME current[Phases];
+	size_t head;
+	size_t frames;
+	size_t total;
+};
+
+FrameStats::FrameStats(size_t c)
+    : PIMPL_CREATE_X(c)
+{
+}
+
+FrameStats::~FrameStats(void)
+{
+	PIMPL_DESTROY;
+}
+
+void
+FrameStats::record(Phase p, MMTIME t)
+{
+	PIMPL->current[p] += t;
+}
+
+void
+FrameStats::commit(void)
+{
+	for (int i = 0; i < Phases; ++i) {
+		PIMPL->samples[i * PIMPL->capacity + PIMPL->head] =
+		    PIMPL->current[i];
+		PIMPL->current[i] = 0;
+	}
+
+	PIMPL->head = (PIMPL->head + 1) % PIMPL->capacity;
+	PIMPL->frames = MMMIN(PIMPL->frames + 1, PIMPL->capacity);
+	++PIMPL->total;
+}
+
+void
+FrameStats::reset(void)
+{
+	std::fill(PIMPL->current, PIMPL->current + Phases, 0);
+	PIMPL->head = PIMPL->frames = PIMPL->total = 0;
+}
+
+size_t
+FrameStats::capacity(void) const
+{
+	return(PIMPL->capacity);
+}
+
+void
+FrameStats::setCapacity(size_t c)
+{
+	PIMPL->capacity = c > 0 ? c : 1;
+	PIMPL->samples.assign(PIMPL->capacity * Phases, 0);
+	PIMPL->scratch.reserve(PIMPL->capacity);
+	reset();
+}
+
+size_t
+FrameStats::frames(void) const
+{
+	return(PIMPL->frames);
+}
+
+size_t
+FrameStats::total(void) const
+{
+	return(PIMPL->total);
+}
+
+MMTIME
+FrameStats::last(Phase p) const
+{
+	if (!PIMPL->frames)
+		return(0);
+	return(PIMPL->ring(p)[PIMPL->last()]);
+}
+
+MMTIME
+FrameStats::average(Phase p) const
+{
+	if (!PIMPL->frames)
+		return(0);
+
+	/* samples past frames() are either unused or stale zeros */
+	const MMTIME *l_ring = PIMPL->ring(p);
+	MMTIME l_sum = 0;
+	for (size_t i = 0; i < PIMPL->frames; ++i)
+		l_sum += l_ring[i];
+	return(l_sum / MMTIME(PIMPL->frames));
+}
+
+MMTIME
+FrameStats::percentile(Phase p, float percent) const
+{
+	if (!PIMPL->frames)
+		return(0);
+
+	const MMTIME *l_ring = PIMPL->ring(p);
+	std::vector<MMTIME> &l_scratch = PIMPL->scratch;
+	l_scratch.assign(l_ring, l_ring + PIMPL->frames);
+
+	/* nearest-rank */
+	const float l_percent = MMMAX(0.f, MMMIN(percent, 100.f));
+	size_t l_rank = static_cast<size_t>
+	    (ceilf(l_percent / 100.f * float(PIMPL->frames)));
+	l_rank = MMMAX(l_rank, static_cast<size_t>(1)) - 1;
+
+	std::nth_element(l_scratch.begin(), l_scratch.begin() + l_rank,
+	    l_scratch.end());
+	return(l_scratch[l_rank]);
+}
+
+MMTIME
+FrameStats::worst(Phase p) const
+{
+	if (!PIMPL->frames)
+		return(0);
+
+	const MMTIME *l_ring = PIMPL->ring(p);
+	return(*std::max_element(l_ring, l_ring + PIMPL->frames));
+}
+
+const char *
+FrameStats::PhaseName(Phase p)
+{
+	static const char *s_names[Phases] = {
+		"BackendTick",
+		"FeatureTick",
+		"EventExecute",
+		"Update",
+		"UpdateDispatch",
+		"Render",
+		"RenderDispatch",
+		"BackendFinish",
+		"Frame"
+	};
+
+	if (p < 0 || p >= Phases)
+		return("Unknown");
+	return(s_names[p]);
+}
+
+} /*********************************************************** Game Namespace */
+MARSHMALLOW_NAMESPACE_END
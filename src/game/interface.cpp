@@ -39,6 +39,7 @@
  */
 
 #include "game/icomponent.h"
+#include "game/icomponentpool.h"
 #include "game/iengine.h"
 #include "game/ienginefeature.h"
 #include "game/ientity.h"
@@ -51,10 +52,24 @@ namespace Game { /******************************************** Game Namespace */
 
 	IComponent::~IComponent(void) {}
 
+	void
+	IComponent::reset(void)
+	    {}
+
+	IComponentPool::~IComponentPool(void) {}
+
 	IEngine::~IEngine(void) {}
 
 	IEngineFeature::~IEngineFeature(void) {}
 
+	IEngineFeature::Affinity
+	IEngineFeature::affinity(void) const
+	    { return(MainThread); }
+
+	bool
+	IEngineFeature::dependsOn(const Core::Type &) const
+	    { return(false); }
+
 	IEntity::~IEntity(void) {}
 
 	IFactory::~IFactory(void) {}
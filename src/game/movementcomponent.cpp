@@ -55,7 +55,6 @@ struct MovementComponent::Private
 	    : limit_x(-1.f, -1.f)
 	    , limit_y(-1.f, -1.f)
 	    , position(0)
-	    , accumulator(.0f)
 	{}
 
 	inline void update(float d);
@@ -65,54 +64,49 @@ struct MovementComponent::Private
 	Math::Pair limit_x;
 	Math::Pair limit_y;
 	PositionComponent *position;
-	float accumulator;
 };
 
+/*
+ * Steps are paced by the engine (see Engine::setFixedStep).
+ */
 void
 MovementComponent::Private::update(float d)
 {
-	static const float step(1.f/60.f);
-
 	if (!position) {
 		MMDEBUG("Game::PositionComponent not found!");
 		return;
 	}
 
-	accumulator += d;
-	while (accumulator >= step) {
-		accumulator -= step;
+	/* update velocity */
 
-		/* update velocity */
+	velocity += acceleration * d;
 
-		velocity += acceleration * step;
+	/* check limit */
 
-		/* check limit */
+	if (limit_x.first()  > -1 && velocity.x < -limit_x.first())
+		velocity.x = -limit_x.first();
+	if (limit_x.second() > -1 && velocity.x >  limit_x.second())
+		velocity.x =  limit_x.second();
 
-		if (limit_x.first()  > -1 && velocity.x < -limit_x.first())
-			velocity.x = -limit_x.first();
-		if (limit_x.second() > -1 && velocity.x >  limit_x.second())
-			velocity.x =  limit_x.second();
+	if (limit_y.first()  > -1 && velocity.y < -limit_y.first())
+		velocity.y = -limit_y.first();
+	if (limit_y.second() > -1 && velocity.y >  limit_y.second())
+		velocity.y =  limit_y.second();
 
-		if (limit_y.first()  > -1 && velocity.y < -limit_y.first())
-			velocity.y = -limit_y.first();
-		if (limit_y.second() > -1 && velocity.y >  limit_y.second())
-			velocity.y =  limit_y.second();
+	/* update position */
 
-		/* update position */
-
-		position->translate(velocity * step);
-	}
+	position->translate(velocity * d);
 }
 
 MovementComponent::MovementComponent(const Core::Identifier &i, Game::IEntity *e)
     : Component(i, e)
-    , PIMPL_CREATE
+    , COMPONENT_PIMPL_CREATE
 {
 }
 
 MovementComponent::~MovementComponent(void)
 {
-	PIMPL_DESTROY;
+	COMPONENT_PIMPL_DESTROY;
 }
 
 const Math::Vector2 &
@@ -232,6 +226,13 @@ MovementComponent::simulate(float d) const
 	return(Math::Point2::Zero());
 }
 
+void
+MovementComponent::reset(void)
+{
+	PIMPL->acceleration = Math::Vector2::Zero();
+	PIMPL->velocity = Math::Vector2::Zero();
+}
+
 void
 MovementComponent::update(float d)
 {
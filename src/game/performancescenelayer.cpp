@@ -0,0 +1,477 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#include "game/performancescenelayer.h"
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+#include "core/framearena.h"
+#include "core/platform.h"
+#include "core/type.h"
+
+#include "math/point2.h"
+
+#include "event/eventmanager.h"
+
+#include "graphics/backend.h"
+#include "graphics/color.h"
+#include "graphics/factory.h"
+#include "graphics/itileset.h"
+#include "graphics/ivertexdata.h"
+#include "graphics/painter.h"
+#include "graphics/quadmesh.h"
+
+#include "game/engine.h"
+#include "game/framestats.h"
+
+#include <cstdio>
+#include <cstring>
+
+#define MIN_CHAR 33
+#define MAX_CHAR 126
+#define HUD_GLYPHS  (MAX_CHAR - MIN_CHAR + 1)
+#define HUD_LINES   4
+#define HUD_COLUMNS 40
+#define HUD_SAMPLES 120
+#define HUD_LEVELS  16
+
+/* layout, in screen pixels */
+#define HUD_MARGIN       4.f
+#define HUD_GRAPH_HEIGHT 48.f
+
+/* full graph height, two 60Hz frames */
+#define HUD_GRAPH_RANGE (2. / 60.)
+
+/* text refresh interval */
+#define HUD_REFRESH .25
+
+MARSHMALLOW_NAMESPACE_BEGIN
+namespace Game { /******************************************** Game Namespace */
+
+/*
+ * Glyph meshes are built once per window size, text is laid out on
+ * refresh into per-glyph runs of origins so each distinct character is a
+ * single draw call. Rendering only walks fixed size arrays.
+ */
+struct PerformanceSceneLayer::Private
+{
+	struct GlyphRun
+	{
+		uint16_t glyph;
+		uint16_t begin;
+		uint16_t count;
+	};
+
+	Private(void)
+	    : tileset(0)
+	    , glyph_vdata(0)
+	    , panel(0)
+	    , panel_origin(0, 0)
+	    , refresh_mark(0)
+	    , fps_mark(0)
+	    , scale(1.f)
+	    , glyph_width(0)
+	    , glyph_height(0)
+	    , bar_width(0)
+	    , run_count(0)
+	    , sample_head(0)
+	    , frames(0)
+	    , fps(0)
+	    , stats_manager(0)
+	    , offset(0)
+	    , invalidated(true)
+	{
+		memset(glyphs, 0, sizeof(glyphs));
+		memset(bars, 0, sizeof(bars));
+		memset(samples, 0, sizeof(samples));
+		memset(lines, 0, sizeof(lines));
+	}
+
+	~Private(void);
+
+	inline void clearMeshes(void);
+	inline void buildMeshes(void);
+	inline void refreshText(void);
+	inline void layoutText(void);
+	inline void sample(void);
+	inline void render(void);
+
+	Graphics::ITileset *tileset;
+	Graphics::IVertexData *glyph_vdata;
+	Graphics::QuadMesh *glyphs[HUD_GLYPHS];
+	Graphics::QuadMesh *bars[HUD_LEVELS];
+	Graphics::QuadMesh *panel;
+	Graphics::Color color;
+	Math::Point2 panel_origin;
+	Math::Point2 graph_origin;
+	Math::Size2i window;
+	Math::Point2 glyph_origins[HUD_LINES * HUD_COLUMNS];
+	Math::Point2 bar_origins[HUD_SAMPLES];
+	GlyphRun runs[HUD_GLYPHS];
+	float samples[HUD_SAMPLES];
+	char lines[HUD_LINES][HUD_COLUMNS + 1];
+	MMTIME refresh_mark;
+	MMTIME fps_mark;
+	float scale;
+	float glyph_width;
+	float glyph_height;
+	float bar_width;
+	size_t run_count;
+	size_t sample_head;
+	unsigned int frames;
+	unsigned int fps;
+	Event::EventManager *stats_manager;
+	uint16_t offset;
+	bool invalidated;
+};
+
+PerformanceSceneLayer::Private::~Private(void)
+{
+	clearMeshes();
+
+	/* disable event statistics again, unless the manager went away */
+	const IEngine *l_engine = Engine::Instance();
+	if (stats_manager && l_engine
+	    && l_engine->eventManager() == stats_manager)
+		stats_manager->setStatsEnabled(false);
+}
+
+void
+PerformanceSceneLayer::Private::clearMeshes(void)
+{
+	for (int i = 0; i < HUD_GLYPHS; ++i)
+		delete glyphs[i], glyphs[i] = 0;
+	for (int i = 0; i < HUD_LEVELS; ++i)
+		delete bars[i], bars[i] = 0;
+	delete panel, panel = 0;
+	delete glyph_vdata, glyph_vdata = 0;
+}
+
+void
+PerformanceSceneLayer::Private::buildMeshes(void)
+{
+	clearMeshes();
+
+	window = Graphics::Backend::WindowSize();
+	if (!tileset || window.width <= 0 || window.height <= 0)
+		return;
+
+	/* painter works in normalized device coordinates here */
+	const float l_px = 2.f / float(window.width);
+	const float l_py = 2.f / float(window.height);
+
+	glyph_width  = float(tileset->tileSize().width)  * scale * l_px;
+	glyph_height = float(tileset->tileSize().height) * scale * l_py;
+
+	glyph_vdata = Graphics::Factory
+	    ::CreateVertexData(MARSHMALLOW_QUAD_VERTEXES);
+	glyph_vdata->set(0, 0,           0);
+	glyph_vdata->set(1, 0,           -glyph_height);
+	glyph_vdata->set(2, glyph_width, 0);
+	glyph_vdata->set(3, glyph_width, -glyph_height);
+
+	for (uint16_t i = 0; i < HUD_GLYPHS; ++i) {
+		glyphs[i] = new Graphics::QuadMesh
+		    (tileset->getTextureCoordinateData
+		         (static_cast<uint16_t>(offset + i)),
+		     tileset->textureData(),
+		     glyph_vdata,
+		     Graphics::QuadMesh::None);
+		glyphs[i]->setColor(color);
+	}
+
+	/* backdrop, top-left corner */
+	const float l_margin_x = HUD_MARGIN * l_px;
+	const float l_margin_y = HUD_MARGIN * l_py;
+	const float l_graph_height = HUD_GRAPH_HEIGHT * l_py;
+	const float l_width = glyph_width * HUD_COLUMNS + l_margin_x * 2;
+	const float l_height = glyph_height * HUD_LINES + l_graph_height
+	    + l_margin_y * 3;
+
+	panel = new Graphics::QuadMesh(l_width, l_height);
+	panel->setColor(Graphics::Color(0.f, 0.f, 0.f, .5f));
+	panel_origin.set(-1.f + l_width / 2.f, 1.f - l_height / 2.f);
+
+	/* one bar per graph level, over budget levels in red */
+	bar_width = glyph_width * HUD_COLUMNS / HUD_SAMPLES;
+	for (int i = 0; i < HUD_LEVELS; ++i) {
+		bars[i] = new Graphics::QuadMesh(bar_width,
+		    l_graph_height * float(i + 1) / HUD_LEVELS);
+		if (i < HUD_LEVELS / 2)
+			bars[i]->setColor(Graphics::Color(.2f, 1.f, .2f, .8f));
+		else
+			bars[i]->setColor(Graphics::Color(1.f, .2f, .2f, .8f));
+	}
+	graph_origin.set(-1.f + l_margin_x, 1.f - l_height + l_margin_y);
+
+	invalidated = false;
+	layoutText();
+}
+
+void
+PerformanceSceneLayer::Private::refreshText(void)
+{
+	const IEngine *l_engine = Engine::Instance();
+	if (!l_engine)
+		return;
+
+	const FrameStats &l_stats = l_engine->frameStats();
+
+	snprintf(lines[0], sizeof(lines[0]),
+	    "FPS %u FRAME %.2fms P99 %.2fms", fps,
+	    l_stats.average(FrameStats::Frame) * 1000.,
+	    l_stats.percentile(FrameStats::Frame, 99) * 1000.);
+
+	snprintf(lines[1], sizeof(lines[1]),
+	    "DRAW %u UPDATE %.2fms RENDER %.2fms",
+	    unsigned(Graphics::Painter::DrawCalls()),
+	    l_stats.average(FrameStats::Update) * 1000.,
+	    l_stats.average(FrameStats::Render) * 1000.);
+
+	lines[2][0] = '\0';
+	if (Event::EventManager *l_manager = l_engine->eventManager()) {
+		/* dispatch counts and peaks are only kept with stats on */
+		if (!l_manager->isStatsEnabled()) {
+			l_manager->setStatsEnabled(true);
+			stats_manager = l_manager;
+		}
+
+		const Event::EventManager::Stats l_events = l_manager->stats();
+		uint32_t l_dispatched = 0;
+		for (size_t i = 0; i < l_events.type_count; ++i)
+			l_dispatched += l_events.types[i].dispatched;
+		snprintf(lines[2], sizeof(lines[2]),
+		    "EVENTS %u PEAK %u BACKLOG %u SENT %u",
+		    unsigned(l_events.queue_depth),
+		    unsigned(l_events.queue_peak),
+		    unsigned(l_events.backlog), l_dispatched);
+	}
+
+	snprintf(lines[3], sizeof(lines[3]), "MEM %.1fMB ARENA %uKB",
+	    double(Core::Platform::MemoryUsage()) / (1024. * 1024.),
+	    unsigned(Core::FrameArena::Instance().peak() / 1024));
+
+	layoutText();
+}
+
+void
+PerformanceSceneLayer::Private::layoutText(void)
+{
+	if (invalidated)
+		return;
+
+	/* count glyphs, then bucket origins by glyph */
+	uint16_t l_count[HUD_GLYPHS];
+	memset(l_count, 0, sizeof(l_count));
+	for (int l = 0; l < HUD_LINES; ++l)
+		for (const char *c = lines[l]; *c; ++c)
+			if (MIN_CHAR <= *c && MAX_CHAR >= *c)
+				++l_count[*c - MIN_CHAR];
+
+	uint16_t l_next[HUD_GLYPHS];
+	uint16_t l_total = 0;
+	run_count = 0;
+	for (uint16_t i = 0; i < HUD_GLYPHS; ++i) {
+		l_next[i] = l_total;
+		if (!l_count[i])
+			continue;
+		GlyphRun &l_run = runs[run_count++];
+		l_run.glyph = i;
+		l_run.begin = l_total;
+		l_run.count = l_count[i];
+		l_total = static_cast<uint16_t>(l_total + l_count[i]);
+	}
+
+	const float l_left = -1.f + HUD_MARGIN * 2.f / float(window.width);
+	float l_y = 1.f - HUD_MARGIN * 2.f / float(window.height);
+	for (int l = 0; l < HUD_LINES; ++l, l_y -= glyph_height) {
+		float l_x = l_left;
+		for (const char *c = lines[l]; *c; ++c, l_x += glyph_width) {
+			if (MIN_CHAR > *c || MAX_CHAR < *c)
+				continue;
+			const int l_glyph = *c - MIN_CHAR;
+			glyph_origins[l_next[l_glyph]++].set(l_x, l_y);
+		}
+	}
+}
+
+void
+PerformanceSceneLayer::Private::sample(void)
+{
+	const IEngine *l_engine = Engine::Instance();
+	if (!l_engine)
+		return;
+
+	/* last complete frame */
+	samples[sample_head] =
+	    float(l_engine->frameStats().last(FrameStats::Frame));
+	sample_head = (sample_head + 1) % HUD_SAMPLES;
+}
+
+void
+PerformanceSceneLayer::Private::render(void)
+{
+	const Math::Size2i &l_window = Graphics::Backend::WindowSize();
+	if (invalidated || l_window.width != window.width
+	    || l_window.height != window.height)
+		buildMeshes();
+	if (invalidated)
+		return;
+
+	sample();
+
+	/* frame rate and text, refreshed a few times per second */
+	const MMTIME l_now = NOW();
+	++frames;
+	if (l_now - fps_mark >= 1.) {
+		fps = unsigned(double(frames) / (l_now - fps_mark) + .5);
+		fps_mark = l_now, frames = 0;
+	}
+	if (l_now - refresh_mark >= HUD_REFRESH) {
+		refreshText();
+		refresh_mark = l_now;
+	}
+
+	Graphics::Painter::PushMatrix();
+	Graphics::Painter::LoadIdentity();
+
+	Graphics::Painter::Draw(*panel, panel_origin);
+
+	for (size_t i = 0; i < run_count; ++i) {
+		const GlyphRun &l_run = runs[i];
+		Graphics::Painter::Draw(*glyphs[l_run.glyph],
+		    &glyph_origins[l_run.begin], l_run.count);
+	}
+
+	/* frame time graph, oldest sample first, one draw per level */
+	for (int l = 0; l < HUD_LEVELS; ++l) {
+		const float l_height = (HUD_GRAPH_HEIGHT * 2.f
+		    / float(window.height)) * float(l + 1) / HUD_LEVELS;
+		size_t l_count = 0;
+		for (size_t i = 0; i < HUD_SAMPLES; ++i) {
+			const float l_sample =
+			    samples[(sample_head + i) % HUD_SAMPLES];
+			int l_level =
+			    int(l_sample / HUD_GRAPH_RANGE * HUD_LEVELS);
+			l_level = MMMIN(MMMAX(l_level, 0), HUD_LEVELS - 1);
+			if (l_level != l)
+				continue;
+			bar_origins[l_count++].set
+			    (graph_origin.x + bar_width * (float(i) + .5f),
+			     graph_origin.y + l_height / 2.f);
+		}
+		if (l_count)
+			Graphics::Painter::Draw(*bars[l], bar_origins, l_count);
+	}
+
+	Graphics::Painter::PopMatrix();
+}
+
+PerformanceSceneLayer::PerformanceSceneLayer(const Core::Identifier &i,
+                                             Game::IScene *s)
+    : SceneLayer(i, s)
+    , PIMPL_CREATE
+{
+}
+
+PerformanceSceneLayer::~PerformanceSceneLayer(void)
+{
+	PIMPL_DESTROY;
+}
+
+Graphics::ITileset *
+PerformanceSceneLayer::tileset(void) const
+{
+	return(PIMPL->tileset);
+}
+
+void
+PerformanceSceneLayer::setTileset(Graphics::ITileset *t, uint16_t o)
+{
+	PIMPL->tileset = t;
+	PIMPL->offset = o;
+	PIMPL->invalidated = true;
+}
+
+float
+PerformanceSceneLayer::scale(void) const
+{
+	return(PIMPL->scale);
+}
+
+void
+PerformanceSceneLayer::setScale(float s)
+{
+	PIMPL->scale = s;
+	PIMPL->invalidated = true;
+}
+
+const Graphics::Color &
+PerformanceSceneLayer::color(void) const
+{
+	return(PIMPL->color);
+}
+
+void
+PerformanceSceneLayer::setColor(const Graphics::Color &c)
+{
+	PIMPL->color = c;
+	for (int i = 0; i < HUD_GLYPHS; ++i)
+		if (PIMPL->glyphs[i])
+			PIMPL->glyphs[i]->setColor(c);
+}
+
+void
+PerformanceSceneLayer::render(void)
+{
+	PIMPL->render();
+}
+
+void
+PerformanceSceneLayer::update(float)
+{
+	/* sampled once per frame during render */
+}
+
+const Core::Type &
+PerformanceSceneLayer::Type(void)
+{
+	static const Core::Type s_type("Game::PerformanceSceneLayer");
+	return(s_type);
+}
+
+} /*********************************************************** Game Namespace */
+MARSHMALLOW_NAMESPACE_END
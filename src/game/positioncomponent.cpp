@@ -41,23 +41,60 @@
 #include "core/identifier.h"
 #include "core/type.h"
 
+#include "game/engine.h"
+
 MARSHMALLOW_NAMESPACE_BEGIN
 namespace Game { /******************************************** Game Namespace */
 
+/*
+ * The position held before the current simulation step is kept around so
+ * renderers can interpolate, it's captured lazily on the first change made
+ * during each step.
+ */
 struct PositionComponent::Private
 {
+	Private(void)
+	    : stamp(0)
+	    , placed(false)
+	{}
+
+	inline void snapshot(void);
+
 	Math::Point2 position;
+	Math::Point2 previous;
+	uint32_t stamp;
+	bool placed;
 };
 
+void
+PositionComponent::Private::snapshot(void)
+{
+	const IEngine *l_engine = Engine::Instance();
+	if (!l_engine)
+		return;
+
+	const uint32_t l_step = l_engine->stepCount();
+
+	/* initial placement is never blended */
+	if (!placed) {
+		placed = true;
+		stamp = l_step - 1;
+	}
+	else if (stamp != l_step) {
+		previous = position;
+		stamp = l_step;
+	}
+}
+
 PositionComponent::PositionComponent(const Core::Identifier &i, Game::IEntity *e)
     : Component(i, e)
-    , PIMPL_CREATE
+    , COMPONENT_PIMPL_CREATE
 {
 }
 
 PositionComponent::~PositionComponent(void)
 {
-	PIMPL_DESTROY;
+	COMPONENT_PIMPL_DESTROY;
 }
 
 const Math::Point2 &
@@ -66,19 +103,47 @@ PositionComponent::position(void) const
 	return(PIMPL->position);
 }
 
+Math::Point2
+PositionComponent::interpolated(void) const
+{
+	const IEngine *l_engine = Engine::Instance();
+
+	/* only blend if we moved during the last simulation step */
+	if (!l_engine || PIMPL->stamp != l_engine->stepCount())
+		return(PIMPL->position);
+
+	const float l_alpha = l_engine->interpolation();
+	return(PIMPL->previous + (PIMPL->position - PIMPL->previous) * l_alpha);
+}
+
 void
 PositionComponent::setPosition(const Math::Point2 &p)
 {
+	PIMPL->snapshot();
 	PIMPL->position = p;
 }
 
 void
 PositionComponent::setPosition(float x, float y)
 {
+	PIMPL->snapshot();
 	PIMPL->position.x = x;
 	PIMPL->position.y = y;
 }
 
+void
+PositionComponent::teleport(const Math::Point2 &p)
+{
+	PIMPL->snapshot();
+	PIMPL->position = PIMPL->previous = p;
+}
+
+void
+PositionComponent::teleport(float x, float y)
+{
+	teleport(Math::Point2(x, y));
+}
+
 float
 PositionComponent::positionX(void) const
 {
@@ -88,6 +153,7 @@ PositionComponent::positionX(void) const
 void
 PositionComponent::setPositionX(float x)
 {
+	PIMPL->snapshot();
 	PIMPL->position.x = x;
 }
 
@@ -100,18 +166,21 @@ PositionComponent::positionY(void) const
 void
 PositionComponent::setPositionY(float y)
 {
+	PIMPL->snapshot();
 	PIMPL->position.y = y;
 }
 
 void
 PositionComponent::translate(const Math::Vector2 &r)
 {
+	PIMPL->snapshot();
 	PIMPL->position += r;
 }
 
 void
 PositionComponent::translate(float x, float y)
 {
+	PIMPL->snapshot();
 	PIMPL->position.x += x;
 	PIMPL->position.y += y;
 }
@@ -119,15 +188,26 @@ PositionComponent::translate(float x, float y)
 void
 PositionComponent::translateX(float x)
 {
+	PIMPL->snapshot();
 	PIMPL->position.x += x;
 }
 
 void
 PositionComponent::translateY(float y)
 {
+	PIMPL->snapshot();
 	PIMPL->position.y += y;
 }
 
+void
+PositionComponent::reset(void)
+{
+	PIMPL->position = Math::Point2::Zero();
+	PIMPL->previous = PIMPL->position;
+	PIMPL->stamp = 0;
+	PIMPL->placed = false;
+}
+
 const Core::Type &
 PositionComponent::Type(void)
 {
@@ -54,13 +54,13 @@ struct PropertyComponent::Private
 PropertyComponent::PropertyComponent(const Core::Identifier &i,
                                      Game::IEntity *e)
     : Component(i, e)
-    , PIMPL_CREATE
+    , COMPONENT_PIMPL_CREATE
 {
 }
 
 PropertyComponent::~PropertyComponent(void)
 {
-	PIMPL_DESTROY;
+	COMPONENT_PIMPL_DESTROY;
 }
 
 std::string
@@ -71,13 +71,13 @@ struct RenderComponent::Private
 
 RenderComponent::RenderComponent(const Core::Identifier &i, Game::IEntity *e)
     : Component(i, e)
-    , PIMPL_CREATE
+    , COMPONENT_PIMPL_CREATE
 {
 }
 
 RenderComponent::~RenderComponent(void)
 {
-	PIMPL_DESTROY;
+	COMPONENT_PIMPL_DESTROY;
 }
 
 Graphics::IMesh *
@@ -104,7 +104,8 @@ void
 RenderComponent::render(void)
 {
 	if (PIMPL->position && PIMPL->mesh)
-		Graphics::Painter::Draw(*PIMPL->mesh, PIMPL->position->position());
+		Graphics::Painter::Draw(*PIMPL->mesh,
+		    PIMPL->position->interpolated());
 }
 
 const Core::Type &
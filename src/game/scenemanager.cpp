@@ -75,14 +75,14 @@ struct SceneManager::Private
 SceneManager::SceneManager(void)
     : PIMPL_CREATE
 {
-	Event::EventManager::Instance()->connect(this, Event::RenderEvent::Type());
-	Event::EventManager::Instance()->connect(this, Event::UpdateEvent::Type());
+	Event::EventManager::Instance()->connect(this, &SceneManager::handleRenderEvent);
+	Event::EventManager::Instance()->connect(this, &SceneManager::handleUpdateEvent);
 }
 
 SceneManager::~SceneManager(void)
 {
-	Event::EventManager::Instance()->disconnect(this, Event::UpdateEvent::Type());
-	Event::EventManager::Instance()->disconnect(this, Event::RenderEvent::Type());
+	Event::EventManager::Instance()->disconnect(this, &SceneManager::handleUpdateEvent);
+	Event::EventManager::Instance()->disconnect(this, &SceneManager::handleRenderEvent);
 
 	PIMPL->stack.clear();
 
@@ -160,6 +160,23 @@ SceneManager::handleEvent(const Event::IEvent &e)
 	return(false);
 }
 
+/*
+ * Typed subscriptions skip the listener table type lookup, but subclasses
+ * may still override handleEvent(), so always dispatch through it.
+ */
+
+bool
+SceneManager::handleRenderEvent(const Event::RenderEvent &e)
+{
+	return(handleEvent(e));
+}
+
+bool
+SceneManager::handleUpdateEvent(const Event::UpdateEvent &e)
+{
+	return(handleEvent(e));
+}
+
 } /*********************************************************** Game Namespace */
 MARSHMALLOW_NAMESPACE_END
 
@@ -52,13 +52,13 @@ struct SizeComponent::Private
 
 SizeComponent::SizeComponent(const Core::Identifier &i, Game::IEntity *e)
     : Component(i, e)
-    , PIMPL_CREATE
+    , COMPONENT_PIMPL_CREATE
 {
 }
 
 SizeComponent::~SizeComponent(void)
 {
-	PIMPL_DESTROY;
+	COMPONENT_PIMPL_DESTROY;
 }
 
 const Math::Size2f &
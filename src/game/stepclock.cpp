@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#include "game/stepclock.h"
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+#include "core/logger.h"
+
+#include <cmath>
+
+MARSHMALLOW_NAMESPACE_BEGIN
+namespace Game { /******************************************** Game Namespace */
+
+struct StepClock::Private
+{
+	Private(float s, int m)
+	    : step(s > 0 ? s : 0)
+	    , accumulator(0)
+	    , max_steps(m > 0 ? m : 1)
+	    , dropped(0)
+	{}
+
+	float step;
+	float accumulator;
+	int max_steps;
+	uint32_t dropped;
+};
+
+StepClock::StepClock(float s, int m)
+    : PIMPL_CREATE_X(s, m)
+{
+}
+
+StepClock::~StepClock(void)
+{
+	PIMPL_DESTROY;
+}
+
+float
+StepClock::step(void) const
+{
+	return(PIMPL->step);
+}
+
+void
+StepClock::setStep(float s)
+{
+	PIMPL->step = s > 0 ? s : 0;
+	PIMPL->accumulator = 0;
+}
+
+int
+StepClock::maxSteps(void) const
+{
+	return(PIMPL->max_steps);
+}
+
+void
+StepClock::reset(void)
+{
+	PIMPL->accumulator = 0;
+}
+
+int
+StepClock::advance(float d)
+{
+	if (PIMPL->step <= 0)
+		return(1);
+
+	PIMPL->accumulator += d;
+
+	int l_steps = 0;
+	while (PIMPL->accumulator >= PIMPL->step
+	    && l_steps < PIMPL->max_steps) {
+		PIMPL->accumulator -= PIMPL->step;
+		++l_steps;
+	}
+
+	/* too far behind, drop whole steps instead of spiraling */
+	if (PIMPL->accumulator >= PIMPL->step) {
+		MMWARNING("Simulation falling behind, dropping steps!");
+		PIMPL->dropped +=
+		    static_cast<uint32_t>(PIMPL->accumulator / PIMPL->step);
+		PIMPL->accumulator = fmodf(PIMPL->accumulator, PIMPL->step);
+	}
+
+	return(l_steps);
+}
+
+float
+StepClock::alpha(void) const
+{
+	return(PIMPL->step > 0 ? PIMPL->accumulator / PIMPL->step : 1.f);
+}
+
+uint32_t
+StepClock::dropped(void) const
+{
+	return(PIMPL->dropped);
+}
+
+} /*********************************************************** Game Namespace */
+MARSHMALLOW_NAMESPACE_END
@@ -39,9 +39,11 @@
  */
 
 #include <map>
+#include <vector>
 
 #include <cassert>
 
+#include "core/framearena.h"
 #include "core/type.h"
 
 #include "graphics/camera.h"
@@ -131,10 +133,16 @@ TilemapSceneLayer::Private::render(void)
 {
 	if (!data || !visible) return;
 
-	typedef std::map<uint32_t, uint32_t> TileIndexCount;
+	/* per-frame temporaries live in the frame arena */
+	typedef std::pair<const uint32_t, uint32_t> TileIndexCountEntry;
+	typedef std::map<uint32_t, uint32_t, std::less<uint32_t>,
+	    Core::FrameAllocator<TileIndexCountEntry> > TileIndexCount;
 	typedef std::pair<float, float> Origin;
-	typedef std::multimap<uint32_t, Origin> TileIndexOrigins;
 	typedef std::pair<uint32_t, Origin> TileIndexOrigin;
+	typedef std::multimap<uint32_t, Origin, std::less<uint32_t>,
+	    Core::FrameAllocator<TileIndexOrigin> > TileIndexOrigins;
+	typedef std::vector<Math::Point2,
+	    Core::FrameAllocator<Math::Point2> > Origins;
 	typedef std::pair<TileIndexOrigins::iterator, TileIndexOrigins::iterator> TileIndexOriginsRange;
 	TileIndexCount   l_tile_count;
 	TileIndexOrigins l_tile_origins;
@@ -216,7 +224,7 @@ TilemapSceneLayer::Private::render(void)
 
 	/* draw tiles */
 
-	Math::Point2   *l_origins = new Math::Point2[l_tile_count_max];
+	Origins         l_origins(l_tile_count_max);
 	Graphics::Color l_color(1.f, 1.f, 1.f, opacity);
 
 	TileIndexCount::iterator ti;
@@ -245,10 +253,9 @@ TilemapSceneLayer::Private::render(void)
 
 			l_mesh.setColor(l_color);
 
-			Graphics::Painter::Draw(l_mesh, l_origins, oic);
+			Graphics::Painter::Draw(l_mesh, &l_origins[0], oic);
 		}
 	}
-	delete [] l_origins;
 }
 
 void
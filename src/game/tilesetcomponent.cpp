@@ -61,13 +61,13 @@ struct TilesetComponent::Private
 
 TilesetComponent::TilesetComponent(const Core::Identifier &i, Game::IEntity *e)
     : Component(i, e)
-    , PIMPL_CREATE
+    , COMPONENT_PIMPL_CREATE
 {
 }
 
 TilesetComponent::~TilesetComponent(void)
 {
-	PIMPL_DESTROY;
+	COMPONENT_PIMPL_DESTROY;
 }
 
 Graphics::ITileset *
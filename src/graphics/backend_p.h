@@ -58,6 +58,16 @@ namespace Graphics { /************************************ Graphics Namespace */
  *
  *  Backend::Setup is required to call Painter::Initialize after successful
  *  Viewport Display construction and Painter::Finalize after destruction.
+ *
+ *  When the engine renders on a dedicated thread (MM_RENDER_THREAD=1),
+ *  Backend::Finish gets called from that thread while Backend::Tick keeps
+ *  running on the main thread, so both must be safe to run concurrently.
+ *  Only backends returning true from Backend::SupportsThreadedRender are
+ *  used this way; the render thread calls Backend::AcquireRenderContext
+ *  before submitting anything and Backend::ReleaseRenderContext on exit.
+ *  The main thread keeps its own context (resource uploads still happen
+ *  there) and calls Backend::Flush after recording each frame.
+ *  Backend::Setup is never called while a render thread is running.
  */
 namespace Backend { /**************************** Graphics::Backend Namespace */
 
@@ -97,6 +107,35 @@ namespace Backend { /**************************** Graphics::Backend Namespace */
 	MARSHMALLOW_GRAPHICS_EXPORT
 	void Finish(void);
 
+	/*
+	 * Backend::SupportsThreadedRender reports whether frames may be
+	 * submitted and presented from a dedicated render thread.
+	 */
+	MARSHMALLOW_GRAPHICS_EXPORT
+	bool SupportsThreadedRender(void);
+
+	/*
+	 * Backend::AcquireRenderContext is called from the render thread, it
+	 * should bind a context sharing resources with the main one.
+	 */
+	MARSHMALLOW_GRAPHICS_EXPORT
+	bool AcquireRenderContext(void);
+
+	/*
+	 * Backend::ReleaseRenderContext is called from the render thread right
+	 * before it exits, releasing everything AcquireRenderContext bound.
+	 */
+	MARSHMALLOW_GRAPHICS_EXPORT
+	void ReleaseRenderContext(void);
+
+	/*
+	 * Backend::Flush is called from the main thread once a frame has been
+	 * recorded, resource changes must be visible to the render context
+	 * afterwards.
+	 */
+	MARSHMALLOW_GRAPHICS_EXPORT
+	void Flush(void);
+
 } /********************************************** Graphics::Backend Namespace */
 } /******************************************************* Graphics Namespace */
 MARSHMALLOW_NAMESPACE_END
@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#include "graphics/drawlist_p.h"
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+#include "core/logger.h"
+#include "core/type.h"
+
+#include "math/point2.h"
+#include "math/vector2.h"
+
+#include "graphics/backend.h"
+#include "graphics/camera.h"
+#include "graphics/transform.h"
+
+#include <vector>
+
+MARSHMALLOW_NAMESPACE_BEGIN
+namespace Graphics { /************************************ Graphics Namespace */
+namespace { /******************************** Graphics::<anonymous> Namespace */
+
+	DrawList *s_recording(0);
+
+} /****************************************** Graphics::<anonymous> Namespace */
+
+/*
+ * Command, origin and mesh data storage is only cleared, never shrunk, so a
+ * list stops allocating once it has seen its busiest frame.
+ */
+struct DrawList::Private
+{
+	std::vector<Command> commands;
+	std::vector<Math::Point2> origins;
+	std::vector<float> data;
+	std::vector<Math::Matrix4> matrix_stack;
+	Math::Matrix4 matrix;
+};
+
+DrawList::DrawList(void)
+    : PIMPL_CREATE
+{
+}
+
+DrawList::~DrawList(void)
+{
+	if (s_recording == this)
+		s_recording = 0;
+
+	PIMPL_DESTROY;
+}
+
+void
+DrawList::clear(void)
+{
+	PIMPL->commands.clear();
+	PIMPL->origins.clear();
+	PIMPL->data.clear();
+	PIMPL->matrix_stack.clear();
+	loadViewProjection();
+}
+
+size_t
+DrawList::size(void) const
+{
+	return(PIMPL->commands.size());
+}
+
+const DrawList::Command &
+DrawList::command(size_t i) const
+{
+	return(PIMPL->commands[i]);
+}
+
+const Math::Point2 *
+DrawList::origins(const Command &c) const
+{
+	return(&PIMPL->origins[c.origin]);
+}
+
+const float *
+DrawList::vertexes(const Command &c) const
+{
+	return(&PIMPL->data[c.vertex]);
+}
+
+const float *
+DrawList::textureCoordinates(const Command &c) const
+{
+	if (!c.texture_coordinates)
+		return(0);
+	return(&PIMPL->data[c.texture_coordinate]);
+}
+
+Math::Matrix4 &
+DrawList::matrix(void)
+{
+	return(PIMPL->matrix);
+}
+
+void
+DrawList::loadIdentity(void)
+{
+	PIMPL->matrix = Math::Matrix4::Identity();
+}
+
+void
+DrawList::loadProjection(void)
+{
+	using namespace Math;
+
+	PIMPL->matrix = Matrix4::Identity();
+	PIMPL->matrix[Matrix4::m11] =  2.f / Backend::Size().width;
+	PIMPL->matrix[Matrix4::m22] =  2.f / Backend::Size().height;
+	PIMPL->matrix[Matrix4::m33] = -1.f;
+}
+
+void
+DrawList::loadViewProjection(void)
+{
+	loadProjection();
+	PIMPL->matrix *= Camera::Transform().matrix(Transform::View);
+}
+
+void
+DrawList::pushMatrix(void)
+{
+	PIMPL->matrix_stack.push_back(PIMPL->matrix);
+}
+
+void
+DrawList::popMatrix(void)
+{
+	if (PIMPL->matrix_stack.empty()) {
+		MMWARNING("Matrix stack is empty! Ignoring pop matrix.");
+		PIMPL->matrix = Math::Matrix4::Identity();
+		return;
+	}
+
+	PIMPL->matrix = PIMPL->matrix_stack.back();
+	PIMPL->matrix_stack.pop_back();
+}
+
+void
+DrawList::draw(const IMesh &m, const Math::Point2 *o, size_t c,
+    unsigned int t)
+{
+	if (!c || !m.vertexData()) return;
+
+	PIMPL->commands.push_back(Command());
+	Command &l_command = PIMPL->commands.back();
+
+	l_command.matrix = PIMPL->matrix;
+	l_command.type = &m.type();
+	l_command.color = m.color();
+	l_command.rotation = m.rotation();
+	m.scale(l_command.scale[0], l_command.scale[1]);
+	l_command.texture = t;
+	l_command.vertexes = m.count();
+	l_command.texture_coordinates = (m.textureCoordinateData() != 0);
+	l_command.origin = PIMPL->origins.size();
+	l_command.count = c;
+
+	PIMPL->origins.insert(PIMPL->origins.end(), o, o + c);
+
+	/* mesh data may change or go away before the list is submitted */
+	std::vector<float> &l_data = PIMPL->data;
+
+	l_command.vertex = l_data.size();
+	for (int i = 0; i < l_command.vertexes; ++i) {
+		const Math::Vector2 l_vertex =
+		    m.vertex(static_cast<uint16_t>(i));
+		l_data.push_back(l_vertex.x);
+		l_data.push_back(l_vertex.y);
+	}
+
+	l_command.texture_coordinate = l_data.size();
+	if (l_command.texture_coordinates)
+		for (int i = 0; i < l_command.vertexes; ++i) {
+			float l_u, l_v;
+			m.textureCoordinate(static_cast<uint16_t>(i), l_u, l_v);
+			l_data.push_back(l_u);
+			l_data.push_back(l_v);
+		}
+}
+
+DrawList *
+DrawList::Recording(void)
+{
+	return(s_recording);
+}
+
+void
+DrawList::SetRecording(DrawList *l)
+{
+	s_recording = l;
+}
+
+Math::Vector2
+DrawListMesh::vertex(uint16_t i) const
+{
+	if (i >= m_command.vertexes) {
+		MMWARNING("Failed to retrieve values for vertex " << i);
+		return(Math::Vector2());
+	}
+
+	const float *l_vertex = m_list.vertexes(m_command) + (i * 2);
+	return(Math::Vector2(l_vertex[0], l_vertex[1]));
+}
+
+void
+DrawListMesh::textureCoordinate(uint16_t i, float &u, float &v) const
+{
+	const float *l_coords = m_list.textureCoordinates(m_command);
+	if (!l_coords || i >= m_command.vertexes) {
+		MMWARNING("Failed to retrieve values for texture coordinate " << i);
+		return;
+	}
+
+	u = l_coords[i * 2];
+	v = l_coords[(i * 2) + 1];
+}
+
+} /******************************************************* Graphics Namespace */
+MARSHMALLOW_NAMESPACE_END
+
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#pragma once
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+#ifndef MARSHMALLOW_GRAPHICS_DRAWLIST_P_H
+#define MARSHMALLOW_GRAPHICS_DRAWLIST_P_H 1
+
+#include "graphics/color.h"
+#include "graphics/imesh.h"
+
+#include "math/matrix4.h"
+
+MARSHMALLOW_NAMESPACE_BEGIN
+namespace Math { /******************************************** Math Namespace */
+	struct Point2;
+} /*********************************************************** Math Namespace */
+
+namespace Graphics { /************************************ Graphics Namespace */
+
+/**** IMPLEMENTATION NOTES *****************************************************
+ *
+ *  While a DrawList is recording, every public Painter call made by the
+ *  recording thread must be redirected to it by the painter implementation;
+ *  matrix operations work on the list's own matrix stack and Draw calls
+ *  capture the mesh state (data, color, rotation, scale) along with the
+ *  current matrix.
+ *
+ *  Recorded lists are replayed with Painter::Submit, possibly from another
+ *  thread while the recording thread moves on to the next frame. Vertex and
+ *  texture coordinate data are copied into the list, so meshes may be
+ *  modified or destroyed right after being drawn. Textures are captured as
+ *  a backend handle resolved by the painter at draw time.
+ *
+ */
+
+	/*! @brief Recorded Painter Commands */
+	class MARSHMALLOW_GRAPHICS_EXPORT
+	DrawList
+	{
+		PRIVATE_IMPLEMENTATION
+		NO_ASSIGN_COPY(DrawList);
+	public:
+
+		struct Command
+		{
+			Math::Matrix4 matrix;
+			const Core::Type *type;
+			Color color;
+			float rotation;
+			float scale[2];
+			unsigned int texture;
+			int vertexes;
+			bool texture_coordinates;
+			size_t vertex;
+			size_t texture_coordinate;
+			size_t origin;
+			size_t count;
+		};
+
+	public:
+
+		DrawList(void);
+		~DrawList(void);
+
+		/*!
+		 * @brief Drop recorded commands and reset matrix state
+		 */
+		void clear(void);
+
+		/*! @brief Number of commands recorded */
+		size_t size(void) const;
+
+		const Command & command(size_t index) const;
+
+		/*! @brief Origins of a recorded command */
+		const Math::Point2 * origins(const Command &command) const;
+
+		/*! @brief Copied vertexes of a recorded command (x, y pairs) */
+		const float * vertexes(const Command &command) const;
+
+		/*!
+		 * @brief Copied texture coordinates of a recorded command
+		 *
+		 * Zero if the mesh had no texture coordinate data.
+		 */
+		const float * textureCoordinates(const Command &command) const;
+
+		/*
+		 * Recording
+		 */
+
+		Math::Matrix4 & matrix(void);
+		void loadIdentity(void);
+		void loadProjection(void);
+		void loadViewProjection(void);
+		void pushMatrix(void);
+		void popMatrix(void);
+
+		/*!
+		 * @brief Record a draw call
+		 *
+		 * @param texture Backend texture handle, zero if untextured.
+		 */
+		void draw(const IMesh &mesh, const Math::Point2 *origins,
+		    size_t count, unsigned int texture);
+
+	public: /* static */
+
+		/*!
+		 * @brief List currently being recorded to, zero if none
+		 */
+		static DrawList * Recording(void);
+
+		/*!
+		 * @brief Start recording painter calls into list
+		 *
+		 * Passing zero stops recording, painter calls will then go to
+		 * the backend directly again.
+		 */
+		static void SetRecording(DrawList *list);
+	};
+
+	/*!
+	 * @brief Mesh view of a recorded command
+	 *
+	 * Recorded commands own no mesh data objects, vertexes and texture
+	 * coordinates are served from the copies held by the list.
+	 */
+	class MARSHMALLOW_GRAPHICS_EXPORT
+	DrawListMesh : public IMesh
+	{
+		NO_ASSIGN_COPY(DrawListMesh);
+
+		const DrawList &m_list;
+		const DrawList::Command &m_command;
+
+	public:
+
+		DrawListMesh(const DrawList &list, const DrawList::Command &command)
+		    : m_list(list), m_command(command) {}
+		virtual ~DrawListMesh(void) {}
+
+	public: /* reimp */
+
+		VIRTUAL ITextureCoordinateData * textureCoordinateData(void) const
+		    { return(0); }
+		VIRTUAL ITextureData * textureData(void) const
+		    { return(0); }
+		VIRTUAL IVertexData * vertexData(void) const
+		    { return(0); }
+
+		VIRTUAL const Graphics::Color & color(void) const
+		    { return(m_command.color); }
+		VIRTUAL float rotation(void) const
+		    { return(m_command.rotation); }
+		VIRTUAL void scale(float &x, float &y) const
+		    { x = m_command.scale[0], y = m_command.scale[1]; }
+
+		VIRTUAL int flags(void) const
+		    { return(None); }
+
+		VIRTUAL Math::Vector2 vertex(uint16_t index) const;
+		VIRTUAL void textureCoordinate(uint16_t index, float &u, float &v) const;
+		VIRTUAL int count(void) const
+		    { return(m_command.vertexes); }
+
+		VIRTUAL const Core::Type & type(void) const
+		    { return(*m_command.type); }
+	};
+
+} /******************************************************* Graphics Namespace */
+MARSHMALLOW_NAMESPACE_END
+
+#endif
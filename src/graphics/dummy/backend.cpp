@@ -74,6 +74,7 @@ Backend::Initialize(void)
 	s_dpy.depth      = MARSHMALLOW_GRAPHICS_DEPTH;
 	s_dpy.fullscreen = MARSHMALLOW_GRAPHICS_FULLSCREEN;
 	s_dpy.height     = MARSHMALLOW_GRAPHICS_HEIGHT;
+	s_dpy.nowait     = false;
 	s_dpy.vsync      = MARSHMALLOW_GRAPHICS_VSYNC;
 	s_dpy.width      = MARSHMALLOW_GRAPHICS_WIDTH;
 
@@ -134,14 +135,38 @@ Backend::Finish(void)
 	using namespace Dummy;
 
 	/* simulated slow swap */
-	if (s_dpy.vsync > 0)
-		Core::Platform::Sleep(double(s_dpy.vsync)/60.);
-	else 
-		Core::Platform::Sleep(.5/60.);
+	if (!s_dpy.nowait) {
+		if (s_dpy.vsync > 0)
+			Core::Platform::Sleep(double(s_dpy.vsync)/60.);
+		else
+			Core::Platform::Sleep(.5/60.);
+	}
 
 	Painter::Reset();
 }
 
+bool
+Backend::SupportsThreadedRender(void)
+{
+	return(true);
+}
+
+bool
+Backend::AcquireRenderContext(void)
+{
+	return(true);
+}
+
+void
+Backend::ReleaseRenderContext(void)
+{
+}
+
+void
+Backend::Flush(void)
+{
+}
+
 const Graphics::Display &
 Backend::Display(void)
 {
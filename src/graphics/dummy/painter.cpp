@@ -45,6 +45,7 @@
 #include "math/point2.h"
 
 #include "graphics/color.h"
+#include "graphics/drawlist_p.h"
 #include "graphics/imesh.h"
 
 MARSHMALLOW_NAMESPACE_BEGIN
@@ -54,6 +55,8 @@ namespace { /************************* Graphics::Dummy::<anonymous> Namespace */
 
 Math::Matrix4  s_matrix_current;
 Color          s_bgcolor;
+size_t         s_draw_calls(0);
+size_t         s_draw_calls_last(0);
 
 } /*********************************** Graphics::Dummy::<anonymous> Namespace */
 } /************************************************ Graphics::Dummy Namespace */
@@ -96,6 +99,8 @@ Math::Matrix4 &
 Painter::Matrix(void)
 {
 	using namespace Dummy;
+	if (DrawList *l_list = DrawList::Recording())
+		return(l_list->matrix());
 	return(s_matrix_current);
 }
 
@@ -103,27 +108,39 @@ void
 Painter::LoadIdentity(void)
 {
 	using namespace Dummy;
+	if (DrawList *l_list = DrawList::Recording()) {
+		l_list->loadIdentity();
+		return;
+	}
 	s_matrix_current = Math::Matrix4::Identity();
 }
 
 void
 Painter::LoadProjection(void)
 {
+	if (DrawList *l_list = DrawList::Recording())
+		l_list->loadProjection();
 }
 
 void
 Painter::PushMatrix(void)
 {
+	if (DrawList *l_list = DrawList::Recording())
+		l_list->pushMatrix();
 }
 
 void
 Painter::LoadViewProjection(void)
 {
+	if (DrawList *l_list = DrawList::Recording())
+		l_list->loadViewProjection();
 }
 
 void
 Painter::PopMatrix(void)
 {
+	if (DrawList *l_list = DrawList::Recording())
+		l_list->popMatrix();
 }
 
 void
@@ -135,6 +152,15 @@ Painter::Draw(const IMesh &m, const Math::Point2 &p)
 void
 Painter::Draw(const IMesh &m, const Math::Point2 *p, size_t c)
 {
+	using namespace Dummy;
+
+	++s_draw_calls;
+
+	if (DrawList *l_list = DrawList::Recording()) {
+		l_list->draw(m, p, c, 0);
+		return;
+	}
+
 	/* Unused if not in verbose debug mode */
 	MMUNUSED(m);
 	MMUNUSED(p);
@@ -143,6 +169,37 @@ Painter::Draw(const IMesh &m, const Math::Point2 *p, size_t c)
 		MMVERBOSE("Drawing " << m.type().str() << " at (" << p[i].x << ", " << p[i].y << ").");
 }
 
+size_t
+Painter::DrawCalls(void)
+{
+	using namespace Dummy;
+	return(s_draw_calls_last);
+}
+
+void
+Painter::EndFrame(void)
+{
+	using namespace Dummy;
+	s_draw_calls_last = s_draw_calls;
+	s_draw_calls = 0;
+}
+
+void
+Painter::Submit(const DrawList &l)
+{
+	const size_t l_size = l.size();
+	for (size_t i = 0; i < l_size; ++i) {
+		const DrawList::Command &l_command = l.command(i);
+		const Math::Point2 *l_origins = l.origins(l_command);
+
+		/* Unused if not in verbose debug mode */
+		MMUNUSED(l_origins);
+
+		for (size_t j = 0; j < l_command.count; ++j)
+			MMVERBOSE("Drawing " << l_command.type->str() << " at (" << l_origins[j].x << ", " << l_origins[j].y << ").");
+	}
+}
+
 } /******************************************************* Graphics Namespace */
 MARSHMALLOW_NAMESPACE_END
 
@@ -174,6 +174,7 @@ BBBackend::Initialize(void)
 	dpy.depth      = MARSHMALLOW_GRAPHICS_DEPTH;
 	dpy.fullscreen = MARSHMALLOW_GRAPHICS_FULLSCREEN;
 	dpy.height     = MARSHMALLOW_GRAPHICS_HEIGHT;
+	dpy.nowait     = false;
 	dpy.width      = MARSHMALLOW_GRAPHICS_WIDTH;
 	dpy.vsync      = MARSHMALLOW_GRAPHICS_VSYNC;
 
@@ -853,6 +854,28 @@ Backend::Finish(void)
 	Painter::Reset();
 }
 
+bool
+Backend::SupportsThreadedRender(void)
+{
+	return(false);
+}
+
+bool
+Backend::AcquireRenderContext(void)
+{
+	return(false);
+}
+
+void
+Backend::ReleaseRenderContext(void)
+{
+}
+
+void
+Backend::Flush(void)
+{
+}
+
 const Graphics::Display &
 Backend::Display(void)
 {
@@ -224,6 +224,7 @@ Qt4Backend::Initialize(void)
 	dpy.depth      = MARSHMALLOW_GRAPHICS_DEPTH;
 	dpy.fullscreen = MARSHMALLOW_GRAPHICS_FULLSCREEN;
 	dpy.height     = MARSHMALLOW_GRAPHICS_HEIGHT;
+	dpy.nowait     = false;
 	dpy.vsync      = MARSHMALLOW_GRAPHICS_VSYNC;
 	dpy.width      = MARSHMALLOW_GRAPHICS_WIDTH;
 
@@ -515,6 +516,28 @@ Backend::Finish(void)
 	Painter::Reset();
 }
 
+bool
+Backend::SupportsThreadedRender(void)
+{
+	return(false);
+}
+
+bool
+Backend::AcquireRenderContext(void)
+{
+	return(false);
+}
+
+void
+Backend::ReleaseRenderContext(void)
+{
+}
+
+void
+Backend::Flush(void)
+{
+}
+
 const Graphics::Display &
 Backend::Display(void)
 {
@@ -51,6 +51,7 @@
 
 #include "core/identifier.h"
 #include "core/logger.h"
+#include "core/platform.h"
 
 #include "event/eventmanager.h"
 #include "event/quitevent.h"
@@ -110,11 +111,15 @@ namespace X11Backend {
 #else
 	inline bool CreateGLXContext(void);
 	inline void DestroyGLXContext(void);
+
+	inline bool AcquireRenderContext(void);
+	inline void ReleaseRenderContext(void);
 #endif
 
 	inline bool CreateX11Window(void);
 	inline void DestroyX11Window(void);
 	inline void ProcessX11Events(void);
+	bool PendingX11Events(void);
 
 	enum StateFlag
 	{
@@ -160,6 +165,7 @@ namespace X11Backend {
 #else
 	/*************************** GLX */
 	GLXContext          glx_ctx;
+	GLXContext          glx_render_ctx;
 #endif
 
 }
@@ -171,14 +177,18 @@ X11Backend::Initialize(void)
 	dpy.depth      = MARSHMALLOW_GRAPHICS_DEPTH;
 	dpy.fullscreen = MARSHMALLOW_GRAPHICS_FULLSCREEN;
 	dpy.height     = MARSHMALLOW_GRAPHICS_HEIGHT;
+	dpy.nowait     = false;
 	dpy.vsync      = MARSHMALLOW_GRAPHICS_VSYNC;
 	dpy.width      = MARSHMALLOW_GRAPHICS_WIDTH;
 
 	Reset(sfUninitialized);
 
 	/*
-	 * Open X11 Display
+	 * Open X11 Display, the render thread swaps buffers while the main
+	 * thread processes events.
 	 */
+	XInitThreads();
+
 	const char *l_display = getenv("DISPLAY");
 	if (!(xdpy = XOpenDisplay(l_display))) {
 		MMERROR("X11: Unable to open display: " << l_display);
@@ -186,6 +196,10 @@ X11Backend::Initialize(void)
 	}
 	flags |= sfX11Display;
 
+	/* wake suspended engine on x11 events, queued ones included */
+	Core::Platform::WatchDescriptor(ConnectionNumber(xdpy));
+	Core::Platform::WatchPending(PendingX11Events);
+
 #ifdef MARSHMALLOW_INPUT_UNIX_X11
 	Input::Unix::X11::InitializeKeyboard(xdpy);
 #endif
@@ -250,6 +264,8 @@ X11Backend::Finalize(void)
 	 * Close X11 Display
 	 */
 	if (sfX11Display == (flags & sfX11Display)) {
+		Core::Platform::UnwatchPending(PendingX11Events);
+		Core::Platform::UnwatchDescriptor(ConnectionNumber(xdpy));
 		XCloseDisplay(xdpy), xdpy = 0;
 		xroot = 0;
 		xvinfo.screen = 0;
@@ -278,6 +294,7 @@ X11Backend::Reset(int state)
 		egl_ctx     = EGL_NO_CONTEXT;
 #else
 		glx_ctx = 0;
+		glx_render_ctx = 0;
 #endif
 	}
 
@@ -289,7 +306,7 @@ X11Backend::Reset(int state)
 		assert(EGL_NO_SURFACE == egl_surface && EGL_NO_CONTEXT == egl_ctx
 		    && "[EGL] Backend didn't get destroyed cleanly!");
 #else
-		assert(0 == glx_ctx
+		assert(0 == glx_ctx && 0 == glx_render_ctx
 		    && "[GLX] Backend didn't get destroyed cleanly!");
 #endif
 	}
@@ -679,6 +696,13 @@ X11Backend::ProcessX11Events(void)
 	}
 }
 
+bool
+X11Backend::PendingX11Events(void)
+{
+	/* Xlib may have read events off the connection already */
+	return(XEventsQueued(xdpy, QueuedAlready) > 0);
+}
+
 bool
 X11Backend::CreateGLContext(void)
 {
@@ -910,6 +934,37 @@ X11Backend::DestroyGLXContext(void)
 		flags ^= sfGLContext;
 	}
 }
+
+bool
+X11Backend::AcquireRenderContext(void)
+{
+	if (sfValid != (flags & sfValid))
+		return(false);
+
+	/* share objects with the main context, uploads happen there */
+	if (!(glx_render_ctx = glXCreateContext(xdpy, &xvinfo, glx_ctx, GL_TRUE))) {
+		MMERROR("GLX: Failed to create render context!");
+		return(false);
+	}
+
+	if (!glXMakeCurrent(xdpy, xwindow, glx_render_ctx)) {
+		MMERROR("GLX: Failed to make render context current!");
+		glXDestroyContext(xdpy, glx_render_ctx), glx_render_ctx = 0;
+		return(false);
+	}
+
+	return(true);
+}
+
+void
+X11Backend::ReleaseRenderContext(void)
+{
+	if (!glx_render_ctx)
+		return;
+
+	glXMakeCurrent(xdpy, None, 0);
+	glXDestroyContext(xdpy, glx_render_ctx), glx_render_ctx = 0;
+}
 #endif
 
 } /********************************** Graphics::OpenGL::<anonymous> Namespace */
@@ -977,6 +1032,43 @@ Backend::Finish(void)
 	Painter::Reset();
 }
 
+bool
+Backend::SupportsThreadedRender(void)
+{
+#ifdef MARSHMALLOW_OPENGL_EGL
+	/* window surfaces can only be current on one thread */
+	return(false);
+#else
+	return(true);
+#endif
+}
+
+bool
+Backend::AcquireRenderContext(void)
+{
+	using namespace OpenGL;
+#ifdef MARSHMALLOW_OPENGL_EGL
+	return(false);
+#else
+	return(X11Backend::AcquireRenderContext());
+#endif
+}
+
+void
+Backend::ReleaseRenderContext(void)
+{
+	using namespace OpenGL;
+#ifndef MARSHMALLOW_OPENGL_EGL
+	X11Backend::ReleaseRenderContext();
+#endif
+}
+
+void
+Backend::Flush(void)
+{
+	glFlush();
+}
+
 const Graphics::Display &
 Backend::Display(void)
 {
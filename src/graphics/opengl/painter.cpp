@@ -49,6 +49,7 @@
 
 #include "graphics/backend_p.h"
 #include "graphics/camera.h"
+#include "graphics/drawlist_p.h"
 #include "graphics/quadmesh.h"
 #include "graphics/transform.h"
 
@@ -86,7 +87,9 @@ namespace GLPainter {
 	inline void Draw(const Graphics::IMesh &mesh,
 	                 const Math::Point2 *origins,
 	                 size_t count);
-	inline void BeginDrawQuadMesh(const Graphics::QuadMesh &mesh, bool tcoords);
+	inline void Submit(const DrawList &list);
+	inline GLuint RecordTexture(const Graphics::IMesh &mesh);
+	inline void BeginDrawQuadMesh(const Graphics::IMesh &mesh, bool tcoords);
 	inline void DrawQuadMesh(void);
 	inline void EndDrawQuadMesh(bool tcoords);
 
@@ -94,7 +97,8 @@ namespace GLPainter {
 	{
 		sfUninitialized = 0,
 		sfInitialized   = (1 << 0),
-		sfInvalidMatrix = (1 << 1)
+		sfInvalidMatrix = (1 << 1),
+		sfSubmitted     = (1 << 2)
 	};
 
 	/* program */
@@ -119,6 +123,10 @@ namespace GLPainter {
 	/* persistent */
 	Graphics::Color bgcolor;
 
+	/* statistics */
+	size_t draw_calls = 0;
+	size_t draw_calls_last = 0;
+
 	unsigned int session_id = 0;
 	int flags;
 
@@ -254,7 +262,16 @@ GLPainter::Reset(void)
 		MMERROR("Matrix stack is not empty! COUNT=" << matrix_stack.size());
 	matrix_stack.empty();
 
-	Painter::LoadViewProjection();
+	/*
+	 * Submitted lists carry their own matrices, skip the reload as it
+	 * would read camera state owned by the recording thread.
+	 */
+	if (flags & sfSubmitted) {
+		flags &= ~(sfSubmitted);
+		return;
+	}
+
+	LoadViewProjection();
 }
 
 GLuint
@@ -457,7 +474,7 @@ GLPainter::Draw(const Graphics::IMesh &m, const Math::Point2 *o, size_t c)
 
 	/* prepare to draw mesh */
 	if (QuadMesh::Type() == m.type())
-		BeginDrawQuadMesh(static_cast<const QuadMesh &>(m), l_tcoords);
+		BeginDrawQuadMesh(m, l_tcoords);
 	else MMWARNING("Unknown mesh type");
 
 	/* draw mesh(es) */
@@ -478,8 +495,109 @@ GLPainter::Draw(const Graphics::IMesh &m, const Math::Point2 *o, size_t c)
 	glDisable(GL_BLEND);
 }
 
+void
+GLPainter::Submit(const DrawList &list)
+{
+	if (0 == (flags & sfInitialized))
+		return;
+
+	flags |= sfSubmitted;
+
+	/*
+	 * The render thread binds its own context, program and capabilities
+	 * are per-context state.
+	 */
+	glUseProgram(program_object);
+	glDisable(GL_CULL_FACE);
+	glDisable(GL_DEPTH_TEST);
+
+	glEnable(GL_BLEND);
+	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+	glActiveTexture(GL_TEXTURE0);
+
+	/* recorded mesh data lives in client memory */
+	OpenGL::Extensions::glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glEnableVertexAttribArray(location_position);
+
+	/* direct draws must rebind their texture */
+	last_texture_id = Core::Identifier();
+
+	GLuint l_texture = 0;
+	Graphics::Transform l_model;
+
+	const size_t l_size = list.size();
+	for (size_t i = 0; i < l_size; ++i) {
+		const DrawList::Command &l_command = list.command(i);
+
+		if (QuadMesh::Type() != *l_command.type) {
+			MMWARNING("Unknown mesh type");
+			continue;
+		}
+
+		matrix = l_command.matrix;
+		flags |= sfInvalidMatrix;
+		CommitMatrix();
+
+		/* color */
+		const Graphics::Color &l_color = l_command.color;
+		glUniform4f(location_color, l_color.red(), l_color.green(), l_color.blue(), l_color.alpha());
+
+		/* texture */
+		if (0 == i || l_texture != l_command.texture) {
+			l_texture = l_command.texture;
+			glBindTexture(GL_TEXTURE_2D, l_texture);
+			glUniform1i(location_usecolor, l_texture ? 0 : 1);
+		}
+
+		/* mesh */
+		glVertexAttribPointer(location_position, 2, GL_FLOAT, GL_FALSE, 0,
+		    list.vertexes(l_command));
+
+		const float *l_tcoords =
+		    l_texture ? list.textureCoordinates(l_command) : 0;
+		if (l_tcoords) {
+			glVertexAttribPointer(location_texcoord, 2, GL_FLOAT,
+			    GL_FALSE, 0, l_tcoords);
+			glEnableVertexAttribArray(location_texcoord);
+		}
+		else glDisableVertexAttribArray(location_texcoord);
+
+		/* draw mesh(es) */
+		l_model.setRotation(l_command.rotation);
+		l_model.setScale(Math::Size2f(l_command.scale[0], l_command.scale[1]));
+
+		const Math::Point2 *l_origins = list.origins(l_command);
+		for (size_t j = 0; j < l_command.count; ++j) {
+			l_model.setTranslation(l_origins[j]);
+			glUniformMatrix4fv(location_model, 1, GL_FALSE, l_model.matrix().data());
+			DrawQuadMesh();
+		}
+	}
+
+	glDisableVertexAttribArray(location_texcoord);
+	glDisableVertexAttribArray(location_position);
+	glDisable(GL_BLEND);
+}
+
+inline GLuint
+GLPainter::RecordTexture(const Graphics::IMesh &m)
+{
+	using OpenGL::TextureData;
+
+	/* resolved by the recording thread, it owns texture uploads */
+	TextureData *l_data = static_cast<TextureData *>(m.textureData());
+	if (!l_data || !l_data->isLoaded())
+		return(0);
+
+	if (l_data->sessionId() != session_id)
+		l_data->reload();
+
+	return(l_data->textureId());
+}
+
 inline void
-GLPainter::BeginDrawQuadMesh(const Graphics::QuadMesh &g, bool tcoords)
+GLPainter::BeginDrawQuadMesh(const Graphics::IMesh &g, bool tcoords)
 {
 	using OpenGL::Extensions::glBindBuffer;
 	using OpenGL::TextureCoordinateData;
@@ -595,6 +713,8 @@ Math::Matrix4 &
 Painter::Matrix(void)
 {
 	using namespace OpenGL;
+	if (DrawList *l_list = DrawList::Recording())
+		return(l_list->matrix());
 	return(GLPainter::matrix);
 }
 
@@ -602,49 +722,84 @@ void
 Painter::LoadIdentity(void)
 {
 	using namespace OpenGL;
-	GLPainter::LoadIdentity();
+	if (DrawList *l_list = DrawList::Recording())
+		l_list->loadIdentity();
+	else GLPainter::LoadIdentity();
 }
 
 void
 Painter::LoadProjection(void)
 {
 	using namespace OpenGL;
-	GLPainter::LoadProjection();
+	if (DrawList *l_list = DrawList::Recording())
+		l_list->loadProjection();
+	else GLPainter::LoadProjection();
 }
 
 void
 Painter::LoadViewProjection(void)
 {
 	using namespace OpenGL;
-	GLPainter::LoadViewProjection();
+	if (DrawList *l_list = DrawList::Recording())
+		l_list->loadViewProjection();
+	else GLPainter::LoadViewProjection();
 }
 
 void
 Painter::PushMatrix(void)
 {
 	using namespace OpenGL;
-	GLPainter::PushMatrix();
+	if (DrawList *l_list = DrawList::Recording())
+		l_list->pushMatrix();
+	else GLPainter::PushMatrix();
 }
 
 void
 Painter::PopMatrix(void)
 {
 	using namespace OpenGL;
-	GLPainter::PopMatrix();
+	if (DrawList *l_list = DrawList::Recording())
+		l_list->popMatrix();
+	else GLPainter::PopMatrix();
 }
 
 void
 Painter::Draw(const IMesh &mesh, const Math::Point2 &origin)
 {
-	using namespace OpenGL;
-	GLPainter::Draw(mesh, &origin, 1);
+	Draw(mesh, &origin, 1);
 }
 
 void
 Painter::Draw(const IMesh &mesh, const Math::Point2 *origins, size_t count)
 {
 	using namespace OpenGL;
-	GLPainter::Draw(mesh, origins, count);
+	++GLPainter::draw_calls;
+	if (DrawList *l_list = DrawList::Recording())
+		l_list->draw(mesh, origins, count,
+		    GLPainter::RecordTexture(mesh));
+	else GLPainter::Draw(mesh, origins, count);
+}
+
+size_t
+Painter::DrawCalls(void)
+{
+	using namespace OpenGL;
+	return(GLPainter::draw_calls_last);
+}
+
+void
+Painter::EndFrame(void)
+{
+	using namespace OpenGL;
+	GLPainter::draw_calls_last = GLPainter::draw_calls;
+	GLPainter::draw_calls = 0;
+}
+
+void
+Painter::Submit(const DrawList &list)
+{
+	using namespace OpenGL;
+	GLPainter::Submit(list);
 }
 
 unsigned int
@@ -46,6 +46,8 @@
 MARSHMALLOW_NAMESPACE_BEGIN
 namespace Graphics { /************************************ Graphics Namespace */
 
+	class DrawList;
+
 /**** IMPLEMENTATION NOTES *****************************************************
  *
  *  Painter::Initialize and Painter::Finalize may be called multiple times
@@ -79,11 +81,29 @@ namespace Painter { /**************************** Graphics::Painter Namespace */
 
 	/*
 	 * Painter::Reset is called post-rendering. The painter should
-	 * automatically reload the View Projection Matrix at this time.
+	 * automatically reload the View Projection Matrix at this time, unless
+	 * the frame was drawn with Painter::Submit (lists record their own).
 	 */
 	MARSHMALLOW_GRAPHICS_EXPORT
 	void Reset(void);
 
+	/*
+	 * Painter::Submit draws every command recorded in a DrawList, it's
+	 * never redirected to a recording list. Painter::Render, Submit and
+	 * Reset may be called from a dedicated render thread, bound to the
+	 * context acquired with Backend::AcquireRenderContext; they must not
+	 * touch state owned by the recording thread (recording list, camera).
+	 */
+	MARSHMALLOW_GRAPHICS_EXPORT
+	void Submit(const DrawList &list);
+
+	/*
+	 * Painter::EndFrame is called by the engine once a frame has been
+	 * drawn (or recorded), it closes the DrawCalls() count.
+	 */
+	MARSHMALLOW_GRAPHICS_EXPORT
+	void EndFrame(void);
+
 } /********************************************** Graphics::Painter Namespace */
 } /******************************************************* Graphics Namespace */
 MARSHMALLOW_NAMESPACE_END
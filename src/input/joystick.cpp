@@ -55,6 +55,13 @@
 
 MARSHMALLOW_NAMESPACE_BEGIN
 namespace Input { /****************************************** Input Namespace */
+namespace { /*********************************** Input::<anonymous> Namespace */
+
+	typedef std::map<size_t, int> ButtonStateMap;
+	ButtonStateMap s_button_state;
+	bool           s_replaying(false);
+
+} /********************************************* Input::<anonymous> Namespace */
 
 bool
 Joystick::Initialize(void)
@@ -74,6 +81,7 @@ Joystick::Finalize(void)
 #ifdef MARSHMALLOW_EVDEV_JOYSTICK
 	Input::Linux::EVDEV::FinalizeJoystick();
 #endif
+	s_button_state.clear();
 }
 
 void
@@ -84,6 +92,34 @@ Joystick::Tick(float)
 #endif
 }
 
+int
+Joystick::ButtonState(size_t joystick)
+{
+	ButtonStateMap::const_iterator l_i = s_button_state.find(joystick);
+	return(l_i != s_button_state.end() ? l_i->second : 0);
+}
+
+void
+Joystick::SetButtonState(size_t joystick, int state)
+{
+	if (!s_replaying)
+		s_button_state[joystick] = state;
+}
+
+void
+Joystick::SetReplaying(bool replaying)
+{
+	/* start from a clean slate either way */
+	s_button_state.clear();
+	s_replaying = replaying;
+}
+
+void
+Joystick::ReplayButtonState(size_t joystick, int state)
+{
+	s_button_state[joystick] = state;
+}
+
 } /********************************************************** Input Namespace */
 MARSHMALLOW_NAMESPACE_END
 
@@ -60,6 +60,24 @@ namespace Joystick { /***************************** Input::Joystick Namespace */
 	MARSHMALLOW_INPUT_EXPORT
 	void Tick(float delta);
 
+	/*!
+	 * @brief Live button state update, ignored while replaying
+	 */
+	MARSHMALLOW_INPUT_EXPORT
+	void SetButtonState(size_t joystick, int state);
+
+	/*!
+	 * @brief Input replay mode
+	 *
+	 * While replaying, live updates are ignored and the button state
+	 * only changes through ReplayButtonState().
+	 */
+	MARSHMALLOW_INPUT_EXPORT
+	void SetReplaying(bool replaying);
+
+	MARSHMALLOW_INPUT_EXPORT
+	void ReplayButtonState(size_t joystick, int state);
+
 } /************************************************ Input::Joystick Namespace */
 } /********************************************************** Input Namespace */
 MARSHMALLOW_NAMESPACE_END
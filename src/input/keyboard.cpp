@@ -60,6 +60,7 @@ namespace { /*********************************** Input::<anonymous> Namespace */
 	typedef std::map<Input::Keyboard::Key,
 	                 Input::Keyboard::Action> KeyState;
 	KeyState s_key_state;
+	bool     s_replaying(false);
 
 } /********************************************* Input::<anonymous> Namespace */
 
@@ -100,6 +101,21 @@ Keyboard::KeyState(Key key)
 
 void
 Keyboard::SetKeyState(Key key, Action action)
+{
+	if (!s_replaying)
+		s_key_state[key] = action;
+}
+
+void
+Keyboard::SetReplaying(bool replaying)
+{
+	/* start from a clean slate either way */
+	s_key_state.clear();
+	s_replaying = replaying;
+}
+
+void
+Keyboard::ReplayKeyState(Key key, Action action)
 {
 	s_key_state[key] = action;
 }
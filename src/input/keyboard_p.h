@@ -60,9 +60,24 @@ namespace Keyboard { /***************************** Input::Keyboard Namespace */
 	MARSHMALLOW_INPUT_EXPORT
 	void Tick(float delta);
 
+	/*!
+	 * @brief Live key state update, ignored while replaying
+	 */
 	MARSHMALLOW_INPUT_EXPORT
 	void SetKeyState(Key key, Action action);
 
+	/*!
+	 * @brief Input replay mode
+	 *
+	 * While replaying, live updates are ignored and the key state only
+	 * changes through ReplayKeyState().
+	 */
+	MARSHMALLOW_INPUT_EXPORT
+	void SetReplaying(bool replaying);
+
+	MARSHMALLOW_INPUT_EXPORT
+	void ReplayKeyState(Key key, Action action);
+
 } /************************************************ Input::Keyboard Namespace */
 } /********************************************************** Input Namespace */
 MARSHMALLOW_NAMESPACE_END
@@ -39,6 +39,7 @@
  */
 
 #include "core/logger.h"
+#include "core/platform.h"
 
 #include <sys/inotify.h>
 
@@ -155,6 +156,8 @@ Initialize(int mask)
 			                               IN_CREATE|IN_DELETE|IN_ATTRIB);
 			if (-1 == s_watch_fd)
 				MMWARNING("INotify watch request failed.");
+			else
+				Core::Platform::WatchDescriptor(s_inotify_fd);
 		}
 	}
 
@@ -188,10 +191,12 @@ Finalize(int mask)
 	if (0 != s_initialized)
 		return;
 
-	if (-1 != s_watch_fd)
-		inotify_rm_watch(s_inotify_fd, s_watch_fd);
+	if (-1 != s_watch_fd) {
+		Core::Platform::UnwatchDescriptor(s_inotify_fd);
+		inotify_rm_watch(s_inotify_fd, s_watch_fd), s_watch_fd = -1;
+	}
 	if (-1 != s_inotify_fd)
-		close(s_inotify_fd);
+		close(s_inotify_fd), s_inotify_fd = -1;
 
 	ED::Map::Finalize();
 }
@@ -39,6 +39,7 @@
  */
 
 #include "core/logger.h"
+#include "core/platform.h"
 
 #include <linux/input.h>
 
@@ -95,6 +96,9 @@ EventDevice::EventDevice(int fd_, Type type_)
 	/* get device name */
 	ioctl(m_fd, EVIOCGNAME(EVDEV_NAME_MAX), m_name);
 
+	/* wake suspended engine on input */
+	Core::Platform::WatchDescriptor(m_fd);
+
 	/* port bit offset */
 	uint8_t l_id_offset;
 
@@ -254,8 +258,10 @@ EventDevice::Open(unsigned int evdev_id, int mask)
 void
 EventDevice::close(void)
 {
-	if (-1 != m_fd)
+	if (-1 != m_fd) {
+		Core::Platform::UnwatchDescriptor(m_fd);
 		::close(m_fd), m_fd = -1;
+	}
 
 	MMDEBUG("Event device closed:"
 		"\""    << m_name << "\" "
@@ -143,19 +143,21 @@ JoystickDevice::handleEvent(struct input_event &event)
 			default: break;
 			}
 
-			IEvent *l_event(new JoystickAxisEvent(
+			EventManager *l_manager = EventManager::Instance();
+			l_manager->queue(l_manager->make<JoystickAxisEvent>(
 			    l_axis,
 			    l_value, -1, 1,
 			    id()));
-			EventManager::Instance()->queue(l_event);
 		}
 
-		IEvent *l_event(new JoystickButtonEvent(
+		Joystick::SetButtonState(id(), m_btn_state);
+
+		EventManager *l_manager = EventManager::Instance();
+		l_manager->queue(l_manager->make<JoystickButtonEvent>(
 		    l_btn,
 		    l_action,
 		    m_btn_state,
 		    id()));
-		EventManager::Instance()->queue(l_event);
 	}
 	else if (event.type == EV_ABS) {
 		Map::EventABSInfo::const_iterator l_entry =
@@ -165,13 +167,13 @@ JoystickDevice::handleEvent(struct input_event &event)
 
 		struct input_absinfo *l_absinfo = l_entry->second;
 
-		IEvent *l_event(new JoystickAxisEvent(
+		EventManager *l_manager = EventManager::Instance();
+		l_manager->queue(l_manager->make<JoystickAxisEvent>(
 		    static_cast<Joystick::Axis>(l_absinfo->value),
 		    event.value,
 		    l_absinfo->minimum,
 		    l_absinfo->maximum,
 		    id()));
-		EventManager::Instance()->queue(l_event);
 	}
 	else return(false);
 	
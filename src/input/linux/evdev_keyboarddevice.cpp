@@ -228,8 +228,9 @@ KeyboardDevice::handleEvent(struct input_event &event)
 	if (l_prev_action != l_action) {
 		Keyboard::SetKeyState(l_key, l_action);
 
-		IEvent *l_event(new KeyboardEvent(l_key, l_action, id()));
-		EventManager::Instance()->queue(l_event);
+		EventManager *l_manager = EventManager::Instance();
+		l_manager->queue
+		    (l_manager->make<KeyboardEvent>(l_key, l_action, id()));
 	}
 
 	return(true);
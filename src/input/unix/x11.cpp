@@ -181,8 +181,9 @@ HandleX11KeyEvent(XKeyEvent &key)
 	const Keyboard::Action l_prev_action = Keyboard::KeyState(l_key);
 	if (l_prev_action != l_action) {
 		Keyboard::SetKeyState(l_key, l_action);
-		Event::EventManager::Instance()->
-		    queue(new Event::KeyboardEvent(l_key, l_action, 0));
+		Event::EventManager *l_manager = Event::EventManager::Instance();
+		l_manager->queue(l_manager->make<Event::KeyboardEvent>
+		    (l_key, l_action, 0));
 	}
 
 	return(true);
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#include "core/framearena.h"
+
+#include "tests/common.h"
+
+#include <map>
+#include <vector>
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+MARSHMALLOW_NAMESPACE_USE
+
+void
+framearena_allocate_test(void)
+{
+	Core::FrameArena l_arena(256);
+
+	char *l_a = static_cast<char *>(l_arena.allocate(3, 1));
+	char *l_b = static_cast<char *>(l_arena.allocate(8, 8));
+	ASSERT_NOT_ZERO("Core::FrameArena::allocate()", l_a);
+	ASSERT_ZERO("Core::FrameArena::allocate() ALIGNMENT",
+	    reinterpret_cast<size_t>(l_b) & 7);
+	ASSERT_TRUE("Core::FrameArena::allocate() LINEAR",
+	    l_b > l_a && l_b - l_a < 16);
+	ASSERT_TRUE("Core::FrameArena::used()", l_arena.used() >= 11);
+
+	/* overflow chains a new block */
+	void *l_big = l_arena.allocate(1024);
+	ASSERT_NOT_ZERO("Core::FrameArena::allocate() OVERFLOW", l_big);
+	const size_t l_capacity = l_arena.capacity();
+	ASSERT_TRUE("Core::FrameArena::capacity() GROW", l_capacity > 1024);
+
+	/* blocks get merged, the same frame fits in one afterwards */
+	l_arena.reset();
+	ASSERT_ZERO("Core::FrameArena::reset()", l_arena.used());
+	ASSERT_EQUAL("Core::FrameArena::reset() MERGE",
+	    l_arena.capacity(), l_capacity);
+
+	l_arena.allocate(3, 1);
+	l_arena.allocate(8, 8);
+	l_arena.allocate(1024);
+	ASSERT_EQUAL("Core::FrameArena::capacity() STABLE",
+	    l_arena.capacity(), l_capacity);
+	ASSERT_TRUE("Core::FrameArena::peak()", l_arena.peak() >= 1024);
+}
+
+void
+framearena_allocator_test(void)
+{
+	Core::FrameArena l_arena(1024);
+
+	typedef Core::FrameAllocator<int> IntAllocator;
+	std::vector<int, IntAllocator> l_vector((IntAllocator(l_arena)));
+	for (int i = 0; i < 1000; ++i)
+		l_vector.push_back(i);
+
+	bool l_ok = true;
+	for (int i = 0; i < 1000; ++i)
+		l_ok &= (l_vector[static_cast<size_t>(i)] == i);
+	ASSERT_TRUE("Core::FrameAllocator std::vector", l_ok);
+
+	typedef std::pair<const int, int> Entry;
+	typedef Core::FrameAllocator<Entry> EntryAllocator;
+	std::map<int, int, std::less<int>, EntryAllocator>
+	    l_map(std::less<int>(), (EntryAllocator(l_arena)));
+	for (int i = 0; i < 100; ++i)
+		l_map[i % 10] += 1;
+	ASSERT_EQUAL("Core::FrameAllocator std::map", l_map.size(), 10u);
+	ASSERT_EQUAL("Core::FrameAllocator std::map VALUE", l_map[3], 10);
+
+	ASSERT_TRUE("Core::FrameAllocator ARENA", l_arena.used() > 0);
+}
+
+TESTS_BEGIN
+	TEST(framearena_allocate_test)
+	TEST(framearena_allocator_test)
+TESTS_END
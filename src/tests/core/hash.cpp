@@ -33,6 +33,7 @@
 #include "core/global.h"
 #include "core/hash.h"
 #include "core/strhash.h"
+#include "core/type.h"
 
 #include "tests/common.h"
 
@@ -61,8 +62,28 @@ strhash_compare_test(void)
 	    Core::StrHash("tset"), Core::StrHash("test"));
 }
 
+void
+type_index_test(void)
+{
+	const Core::Type l_a("Test::A");
+	const Core::Type l_b("Test::B");
+	const Core::Type l_a2("Test::A");
+
+	const int l_a_index = l_a.index();
+	const int l_b_index = l_b.index();
+
+	ASSERT_TRUE("Core::Type() index NOT NEGATIVE", l_a_index >= 0);
+	ASSERT_NOT_EQUAL("Core::Type() 'Test::B' INDEX NOT EQUAL TO 'Test::A'",
+	    l_b_index, l_a_index);
+	ASSERT_EQUAL("Core::Type() 'Test::A' INDEX STABLE",
+	    l_a2.index(), l_a_index);
+	ASSERT_EQUAL("Core::Type() copy KEEPS INDEX",
+	    Core::Type(l_b).index(), l_b_index);
+}
+
 TESTS_BEGIN
 	TEST(hash_compare_test)
 	TEST(strhash_compare_test)
+	TEST(type_index_test)
 TESTS_END
 
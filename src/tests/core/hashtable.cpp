@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#include "core/hashtable_p.h"
+
+#include "tests/common.h"
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+MARSHMALLOW_NAMESPACE_USE
+
+#define HASH_TABLE_MIN (1 << HASH_TABLE_BITS)
+
+namespace {
+	typedef Core::HashTable<MMUID, int> IntTable;
+
+	/* next key after start landing on home slot of an empty table */
+	MMUID
+	KeyForSlot(size_t slot, MMUID start)
+	{
+		while ((Core::HashKey(start) >> (32 - HASH_TABLE_BITS)) != slot)
+			++start;
+		return(start);
+	}
+}
+
+void
+hashtable_insert_test(void)
+{
+	IntTable l_table;
+
+	ASSERT_TRUE("Core::HashTable::find() EMPTY", !l_table.find(1));
+
+	l_table.insert(1) = 10;
+	l_table.insert(2) = 20;
+	ASSERT_TRUE("Core::HashTable::insert()", l_table.size() == 2);
+	ASSERT_TRUE("Core::HashTable::capacity()",
+	    l_table.capacity() == HASH_TABLE_MIN);
+
+	/* existing keys keep their value */
+	const int l_value = l_table.insert(1);
+	ASSERT_TRUE("Core::HashTable::insert() EXISTING",
+	    l_value == 10 && l_table.size() == 2);
+
+	int *l_found = l_table.find(2);
+	ASSERT_TRUE("Core::HashTable::find()", l_found && *l_found == 20);
+	ASSERT_TRUE("Core::HashTable::find() MISSING", !l_table.find(3));
+}
+
+void
+hashtable_erase_test(void)
+{
+	IntTable l_table;
+
+	l_table.insert(1) = 10;
+	l_table.insert(2) = 20;
+
+	l_table.erase(1);
+	ASSERT_TRUE("Core::HashTable::erase()",
+	    !l_table.find(1) && l_table.size() == 1);
+
+	/* erasing missing keys is harmless */
+	l_table.erase(1);
+	l_table.erase(3);
+	ASSERT_TRUE("Core::HashTable::erase() MISSING", l_table.size() == 1);
+
+	int *l_found = l_table.find(2);
+	ASSERT_TRUE("Core::HashTable::erase() KEEPS",
+	    l_found && *l_found == 20);
+
+	/* reinsert is default constructed */
+	const int l_value = l_table.insert(1);
+	ASSERT_ZERO("Core::HashTable::insert() REINSERT", l_value);
+}
+
+void
+hashtable_wrap_test(void)
+{
+	IntTable l_table;
+
+	/* a, b and c share the last slot, b and c wrap around */
+	const MMUID l_a = KeyForSlot(HASH_TABLE_MIN - 1, 1);
+	const MMUID l_b = KeyForSlot(HASH_TABLE_MIN - 1, l_a + 1);
+	const MMUID l_c = KeyForSlot(HASH_TABLE_MIN - 1, l_b + 1);
+
+	/* d and e get pushed behind c */
+	const MMUID l_d = KeyForSlot(0, 1);
+	const MMUID l_e = KeyForSlot(1, 1);
+
+	l_table.insert(l_a) = 1;
+	l_table.insert(l_b) = 2;
+	l_table.insert(l_c) = 3;
+	l_table.insert(l_d) = 4;
+	l_table.insert(l_e) = 5;
+	ASSERT_TRUE("Core::HashTable::insert() COLLIDING",
+	    l_table.size() == 5 && l_table.capacity() == HASH_TABLE_MIN);
+
+	/* followers shift back across the wrap */
+	l_table.erase(l_a);
+	int *l_fb = l_table.find(l_b);
+	int *l_fc = l_table.find(l_c);
+	int *l_fd = l_table.find(l_d);
+	int *l_fe = l_table.find(l_e);
+	ASSERT_TRUE("Core::HashTable::erase() WRAP SHIFT",
+	    !l_table.find(l_a) &&
+	    l_fb && *l_fb == 2 && l_fc && *l_fc == 3 &&
+	    l_fd && *l_fd == 4 && l_fe && *l_fe == 5);
+
+	/* d sits past its home slot and must stay reachable */
+	l_table.erase(l_c);
+	l_fb = l_table.find(l_b);
+	l_fd = l_table.find(l_d);
+	l_fe = l_table.find(l_e);
+	ASSERT_TRUE("Core::HashTable::erase() HOME SLOT",
+	    !l_table.find(l_c) && l_table.size() == 3 &&
+	    l_fb && *l_fb == 2 && l_fd && *l_fd == 4 && l_fe && *l_fe == 5);
+}
+
+void
+hashtable_grow_test(void)
+{
+	IntTable l_table;
+
+	for (int i = 0; i < 1000; ++i)
+		l_table.insert(static_cast<MMUID>(i)) = i;
+	ASSERT_TRUE("Core::HashTable::insert() GROW",
+	    l_table.size() == 1000 && l_table.capacity() == 2048);
+
+	for (int i = 0; i < 1000; i += 2)
+		l_table.erase(static_cast<MMUID>(i));
+
+	bool l_ok = l_table.size() == 500;
+	for (int i = 0; i < 1000; ++i) {
+		int *l_found = l_table.find(static_cast<MMUID>(i));
+		l_ok = l_ok && (i % 2 ? l_found && *l_found == i : !l_found);
+	}
+	ASSERT_TRUE("Core::HashTable::erase() GROWN", l_ok);
+}
+
+void
+hashtable_spread_test(void)
+{
+	/* aligned keys must not crowd into a subset of home slots */
+	bool l_seen[HASH_TABLE_MIN] = { false };
+	size_t l_homes = 0;
+	for (MMUID i = 0; i < HASH_TABLE_MIN; ++i) {
+		const size_t l_home =
+		    Core::HashKey(i * 8) >> (32 - HASH_TABLE_BITS);
+		if (!l_seen[l_home]) {
+			l_seen[l_home] = true;
+			++l_homes;
+		}
+	}
+	ASSERT_TRUE("Core::HashKey() ALIGNED SPREAD",
+	    l_homes > HASH_TABLE_MIN / 4u);
+
+	/* pointer keys reach odd home slots too */
+	static char s_buffer[HASH_TABLE_MIN * 16];
+	size_t l_odd = 0;
+	for (int i = 0; i < HASH_TABLE_MIN; ++i)
+		l_odd += (Core::HashKey(&s_buffer[i * 16])
+		    >> (32 - HASH_TABLE_BITS)) & 1;
+	ASSERT_TRUE("Core::HashKey() POINTER ODD SLOTS", l_odd > 0);
+}
+
+TESTS_BEGIN
+	TEST(hashtable_insert_test)
+	TEST(hashtable_erase_test)
+	TEST(hashtable_wrap_test)
+	TEST(hashtable_grow_test)
+	TEST(hashtable_spread_test)
+TESTS_END
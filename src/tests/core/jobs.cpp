@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#include "core/atomic.h"
+#include "core/jobs.h"
+#include "core/platform.h"
+
+#include "tests/common.h"
+
+#include <vector>
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+MARSHMALLOW_NAMESPACE_USE
+
+namespace {
+
+void
+IncrementJob(void *data)
+{
+	Core::Atomic::Increment(static_cast<volatile int32_t *>(data));
+}
+
+void
+DoubleRange(void *data, size_t begin, size_t end)
+{
+	std::vector<int> &l_values = *static_cast<std::vector<int> *>(data);
+	for (size_t i = begin; i < end; ++i)
+		l_values[i] = static_cast<int>(i) * 2;
+}
+
+struct Ordering
+{
+	volatile int32_t first;
+	volatile int32_t seen;
+};
+
+void
+SlowFirstJob(void *data)
+{
+	Ordering *l_order = static_cast<Ordering *>(data);
+	Core::Platform::Sleep(.01);
+	Core::Atomic::CompareAndSwap(&l_order->first, 0, 1);
+}
+
+void
+SecondJob(void *data)
+{
+	Ordering *l_order = static_cast<Ordering *>(data);
+	Core::Atomic::CompareAndSwap(&l_order->seen, 0,
+	    Core::Atomic::Load(&l_order->first) + 1);
+}
+
+void
+NestedJob(void *data)
+{
+	/* waits from inside a worker must help, not block */
+	Core::Jobs::ParallelFor(DoubleRange, data, 0,
+	    static_cast<std::vector<int> *>(data)->size(), 64);
+}
+
+void
+SlowIncrementJob(void *data)
+{
+	Core::Platform::Sleep(.02);
+	IncrementJob(data);
+}
+
+void
+SlowRange(void *data, size_t begin, size_t end)
+{
+	Core::Platform::Sleep(.005);
+	DoubleRange(data, begin, end);
+}
+
+void
+NestedSlowJob(void *data)
+{
+	Core::Jobs::ParallelFor(SlowRange, data, 0,
+	    static_cast<std::vector<int> *>(data)->size(), 256);
+}
+
+bool
+CheckDoubled(const std::vector<int> &values)
+{
+	for (size_t i = 0; i < values.size(); ++i)
+		if (values[i] != static_cast<int>(i) * 2)
+			return(false);
+	return(true);
+}
+
+} // namespace
+
+void
+jobs_serial_test(void)
+{
+	volatile int32_t l_count = 0;
+	Core::Jobs::Counter l_counter;
+
+	Core::Jobs::Run(IncrementJob, const_cast<int32_t *>(&l_count), &l_counter);
+	ASSERT_TRUE("Core::Jobs::Run() SERIAL INLINE", l_count == 1);
+	ASSERT_TRUE("Core::Jobs::Counter::isDone() SERIAL", l_counter.isDone());
+
+	std::vector<int> l_values(1000, -1);
+	Core::Jobs::ParallelFor(DoubleRange, &l_values, 0, l_values.size());
+	ASSERT_TRUE("Core::Jobs::ParallelFor() SERIAL", CheckDoubled(l_values));
+}
+
+void
+jobs_parallel_test(void)
+{
+	Core::Jobs::Initialize(3);
+	ASSERT_EQUAL("Core::Jobs::Workers()", Core::Jobs::Workers(), 3u);
+
+	volatile int32_t l_count = 0;
+	Core::Jobs::Counter l_counter;
+	for (int i = 0; i < 1000; ++i)
+		Core::Jobs::Run(IncrementJob, const_cast<int32_t *>(&l_count),
+		    &l_counter);
+	Core::Jobs::Wait(l_counter);
+	ASSERT_TRUE("Core::Jobs::Wait() ALL JOBS RAN", l_count == 1000);
+
+	std::vector<int> l_values(100000, -1);
+	Core::Jobs::ParallelFor(DoubleRange, &l_values, 0, l_values.size());
+	ASSERT_TRUE("Core::Jobs::ParallelFor()", CheckDoubled(l_values));
+
+	std::vector<int> l_odd(1001, -1);
+	Core::Jobs::Counter l_range;
+	Core::Jobs::ParallelFor(DoubleRange, &l_odd, 0, l_odd.size(), 100,
+	    &l_range);
+	Core::Jobs::Wait(l_range);
+	ASSERT_TRUE("Core::Jobs::ParallelFor() GRAIN", CheckDoubled(l_odd));
+
+	Core::Jobs::Finalize();
+	ASSERT_EQUAL("Core::Jobs::Finalize()", Core::Jobs::Workers(), 0u);
+}
+
+void
+jobs_dependency_test(void)
+{
+	Core::Jobs::Initialize(2);
+
+	Ordering l_order;
+	l_order.first = l_order.seen = 0;
+
+	Core::Jobs::Counter l_first;
+	Core::Jobs::Counter l_second;
+	Core::Jobs::Run(SlowFirstJob, &l_order, &l_first);
+	Core::Jobs::Run(SecondJob, &l_order, &l_second, &l_first);
+	Core::Jobs::Wait(l_second);
+	ASSERT_TRUE("Core::Jobs::Run() DEPENDENCY ORDER", l_order.seen == 2);
+
+	std::vector<int> l_values(4096, -1);
+	Core::Jobs::Counter l_nested;
+	Core::Jobs::Run(NestedJob, &l_values, &l_nested);
+	Core::Jobs::Wait(l_nested);
+	ASSERT_TRUE("Core::Jobs::ParallelFor() NESTED", CheckDoubled(l_values));
+
+	Core::Jobs::Finalize();
+}
+
+void
+jobs_wait_test(void)
+{
+	Core::Jobs::Initialize(2);
+
+	/* long enough for the waiter to give up spinning and block */
+	volatile int32_t l_count = 0;
+	Core::Jobs::Counter l_counter;
+	for (int i = 0; i < 4; ++i)
+		Core::Jobs::Run(SlowIncrementJob,
+		    const_cast<int32_t *>(&l_count), &l_counter);
+	Core::Jobs::Wait(l_counter);
+	ASSERT_TRUE("Core::Jobs::Wait() BLOCKED", l_count == 4);
+
+	/* workers blocked in nested waits still get woken up for new jobs */
+	std::vector<int> l_values[4];
+	Core::Jobs::Counter l_nested;
+	for (int i = 0; i < 4; ++i) {
+		l_values[i].assign(2048, -1);
+		Core::Jobs::Run(NestedSlowJob, &l_values[i], &l_nested);
+	}
+	Core::Jobs::Wait(l_nested);
+
+	bool l_doubled = true;
+	for (int i = 0; i < 4; ++i)
+		l_doubled &= CheckDoubled(l_values[i]);
+	ASSERT_TRUE("Core::Jobs::Wait() NESTED BLOCKED", l_doubled);
+
+	Core::Jobs::Finalize();
+}
+
+TESTS_BEGIN
+	TEST(jobs_serial_test)
+	TEST(jobs_parallel_test)
+	TEST(jobs_dependency_test)
+	TEST(jobs_wait_test)
+TESTS_END
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#include "core/platform.h"
+
+#include "tests/common.h"
+
+#include <unistd.h>
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+MARSHMALLOW_NAMESPACE_USE
+
+namespace {
+
+/* returns time spent waiting */
+MMTIME
+TimedWait(MMTIME timeout, bool *waited = 0)
+{
+	const MMTIME l_start = NOW();
+	const bool l_waited = Core::Platform::WaitEvents(timeout);
+	if (waited) *waited = l_waited;
+	return(NOW() - l_start);
+}
+
+bool s_pending(false);
+
+bool
+Pending(void)
+{
+	return(s_pending);
+}
+
+} // namespace
+
+void
+platform_wait_events_test(void)
+{
+	Core::Platform::Initialize();
+
+	bool l_waited = true;
+	TimedWait(1., &l_waited);
+	ASSERT_FALSE("Core::Platform::WaitEvents() NOTHING TO WATCH", l_waited);
+
+	int l_pipe[2];
+	const int l_rc = pipe(l_pipe);
+	ASSERT_ZERO("pipe()", l_rc);
+	Core::Platform::WatchDescriptor(l_pipe[0]);
+
+	MMTIME l_time = TimedWait(.02, &l_waited);
+	ASSERT_TRUE("Core::Platform::WaitEvents()", l_waited);
+	ASSERT_TRUE("Core::Platform::WaitEvents() TIMEOUT", l_time >= .015);
+
+	/* pending wakeup returns right away, then gets drained */
+	Core::Platform::Wake();
+	l_time = TimedWait(5.);
+	ASSERT_TRUE("Core::Platform::Wake()", l_time < 1.);
+	l_time = TimedWait(.02);
+	ASSERT_TRUE("Core::Platform::Wake() DRAINED", l_time >= .015);
+
+	/* input buffered in user space returns right away */
+	Core::Platform::WatchPending(Pending);
+	s_pending = true;
+	l_time = TimedWait(5.);
+	ASSERT_TRUE("Core::Platform::WatchPending()", l_time < 1.);
+	s_pending = false;
+	l_time = TimedWait(.02);
+	ASSERT_TRUE("Core::Platform::WatchPending() NOTHING QUEUED",
+	    l_time >= .015);
+	Core::Platform::UnwatchPending(Pending);
+	s_pending = true;
+	l_time = TimedWait(.02);
+	ASSERT_TRUE("Core::Platform::UnwatchPending()", l_time >= .015);
+	s_pending = false;
+
+	/* readable descriptor */
+	const char l_byte = 1;
+	const ssize_t l_written = write(l_pipe[1], &l_byte, 1);
+	ASSERT_EQUAL("write()", l_written, 1);
+	l_time = TimedWait(5.);
+	ASSERT_TRUE("Core::Platform::WatchDescriptor()", l_time < 1.);
+
+	Core::Platform::UnwatchDescriptor(l_pipe[0]);
+	TimedWait(1., &l_waited);
+	ASSERT_FALSE("Core::Platform::UnwatchDescriptor()", l_waited);
+
+	close(l_pipe[0]);
+	close(l_pipe[1]);
+
+	/* hung up descriptor gets dropped instead of waking us forever */
+	const int l_hup_rc = pipe(l_pipe);
+	ASSERT_ZERO("pipe()", l_hup_rc);
+	Core::Platform::WatchDescriptor(l_pipe[0]);
+	close(l_pipe[1]);
+	l_time = TimedWait(5.);
+	ASSERT_TRUE("Core::Platform::WaitEvents() HANGUP", l_time < 1.);
+	TimedWait(1., &l_waited);
+	ASSERT_FALSE("Core::Platform::WaitEvents() HANGUP UNWATCHED", l_waited);
+	close(l_pipe[0]);
+
+	Core::Platform::Finalize();
+}
+
+TESTS_BEGIN
+	TEST(platform_wait_events_test)
+TESTS_END
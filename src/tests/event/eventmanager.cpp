@@ -0,0 +1,841 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#include "core/identifier.h"
+#include "core/platform.h"
+#include "core/thread.h"
+#include "core/type.h"
+
+#include "event/eventmanager.h"
+#include "event/ieventlistener.h"
+#include "event/joystickaxisevent.h"
+#include "event/keyboardevent.h"
+#include "event/quitevent.h"
+#include "event/touchevent.h"
+
+#include "tests/common.h"
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+MARSHMALLOW_NAMESPACE_USE
+
+#define PRODUCER_COUNT  4
+#define PRODUCER_EVENTS 10000
+
+struct CountingListener : public Event::IEventListener
+{
+	CountingListener(void)
+	    : count(0)
+	    , ordered(true)
+	{
+		for (int i = 0; i < PRODUCER_COUNT; ++i)
+			last[i] = -1;
+	}
+
+	virtual bool handleEvent(const Event::IEvent &e)
+	{
+		const int l_code = static_cast<const Event::QuitEvent &>(e).code();
+		const int l_producer = l_code / PRODUCER_EVENTS;
+
+		/* events from a single producer must keep their order */
+		if (l_producer < PRODUCER_COUNT) {
+			ordered &= (last[l_producer] < l_code);
+			last[l_producer] = l_code;
+		}
+
+		++count;
+		return(false);
+	}
+
+	int count;
+	int last[PRODUCER_COUNT];
+	bool ordered;
+};
+
+class PriorityEvent : public Event::Event
+{
+	int m_tag;
+public:
+
+	PriorityEvent(int tag, uint8_t priority, MMTIME timestamp = 0)
+	    : Event(timestamp, priority)
+	    , m_tag(tag)
+	{}
+
+	int tag(void) const
+	    { return(m_tag); }
+
+	virtual const Core::Type & type(void) const
+	    { return(Type()); }
+
+	static const Core::Type & Type(void)
+	    { static const Core::Type s_type("Test::PriorityEvent");
+	      return(s_type); }
+};
+
+struct RecordingListener : public Event::IEventListener
+{
+	RecordingListener(void) : count(0) {}
+
+	virtual bool handleEvent(const Event::IEvent &e)
+	{
+		if (count < 8)
+			tags[count] = static_cast<const PriorityEvent &>(e).tag();
+		++count;
+		return(false);
+	}
+
+	int count;
+	int tags[8];
+};
+
+struct MutatingListener : public Event::IEventListener
+{
+	MutatingListener(void)
+	    : manager(0)
+	    , disconnect(0)
+	    , connect(0)
+	    , count(0)
+	{}
+
+	virtual bool handleEvent(const Event::IEvent &e)
+	{
+		if (manager && disconnect)
+			manager->disconnect(disconnect, e.type());
+		if (manager && connect)
+			manager->connect(connect, e.type());
+		disconnect = connect = 0;
+
+		++count;
+		return(false);
+	}
+
+	Event::EventManager *manager;
+	Event::IEventListener *disconnect;
+	Event::IEventListener *connect;
+	int count;
+};
+
+struct Producer
+{
+	Event::EventManager *manager;
+	int id;
+};
+
+static void
+producer_proc(void *data)
+{
+	Producer *l_producer = static_cast<Producer *>(data);
+	const int l_base = l_producer->id * PRODUCER_EVENTS;
+
+	for (int i = 0; i < PRODUCER_EVENTS; ++i)
+		l_producer->manager->queue(new Event::QuitEvent(l_base + i));
+}
+
+void
+eventmanager_serial_queue_test(void)
+{
+	Event::EventManager l_manager("Test.EventManager");
+	CountingListener l_listener;
+
+	ASSERT_EQUAL("Event::EventManager::queueMode() DEFAULT SERIAL",
+	    Event::EventManager::SerialQueue, l_manager.queueMode());
+
+	l_manager.connect(&l_listener, Event::QuitEvent::Type());
+
+	for (int i = 0; i < 10; ++i)
+		l_manager.queue(new Event::QuitEvent(i));
+
+	l_manager.execute();
+	ASSERT_ZERO("Event::EventManager::execute() NOTHING ACTIVE",
+	    l_listener.count);
+
+	l_manager.execute();
+	ASSERT_EQUAL("Event::EventManager::execute() DISPATCHED QUEUE",
+	    10, l_listener.count);
+	ASSERT_TRUE("Event::EventManager::execute() IN ORDER",
+	    l_listener.ordered);
+
+	l_manager.disconnect(&l_listener, Event::QuitEvent::Type());
+}
+
+void
+eventmanager_concurrent_queue_test(void)
+{
+	Event::EventManager l_manager("Test.EventManager",
+	    Event::EventManager::ConcurrentQueue);
+	CountingListener l_listener;
+
+	ASSERT_EQUAL("Event::EventManager::queueMode() CONCURRENT",
+	    Event::EventManager::ConcurrentQueue, l_manager.queueMode());
+
+	l_manager.connect(&l_listener, Event::QuitEvent::Type());
+
+	Producer l_producer[PRODUCER_COUNT];
+	Core::Thread *l_thread[PRODUCER_COUNT];
+	for (int i = 0; i < PRODUCER_COUNT; ++i) {
+		l_producer[i].manager = &l_manager;
+		l_producer[i].id = i;
+		l_thread[i] = new Core::Thread(producer_proc, &l_producer[i]);
+		l_thread[i]->start();
+	}
+
+	/* consume while producers are still running */
+	const int l_total = PRODUCER_COUNT * PRODUCER_EVENTS;
+	const MMTIME l_timeout = NOW() + 10.;
+	while (l_listener.count < l_total && NOW() < l_timeout)
+		l_manager.execute();
+
+	for (int i = 0; i < PRODUCER_COUNT; ++i)
+		delete l_thread[i];
+
+	ASSERT_EQUAL("Event::EventManager::execute() DISPATCHED ALL POSTED",
+	    l_total, l_listener.count);
+	ASSERT_TRUE("Event::EventManager::execute() PRODUCER ORDER KEPT",
+	    l_listener.ordered);
+
+	l_manager.disconnect(&l_listener, Event::QuitEvent::Type());
+}
+
+void
+eventmanager_arena_test(void)
+{
+	Event::EventManager l_manager("Test.EventManager");
+	CountingListener l_listener;
+
+	l_manager.connect(&l_listener, Event::QuitEvent::Type());
+
+	const Event::QuitEvent *l_first = 0;
+	for (int i = 0; i < 100; ++i) {
+		Event::QuitEvent *l_event = l_manager.make<Event::QuitEvent>(i);
+		ASSERT_TRUE("Event::EventManager::make() ALLOCATED", l_event != 0);
+		if (!l_first) l_first = l_event;
+		l_manager.queue(l_event);
+	}
+
+	/* dispatch and recycle arena */
+	l_manager.execute();
+	l_manager.execute();
+	ASSERT_EQUAL("Event::EventManager::execute() DISPATCHED ARENA EVENTS",
+	    100, l_listener.count);
+	ASSERT_TRUE("Event::EventManager::execute() IN ORDER",
+	    l_listener.ordered);
+
+	/* drained arena is rewound and pending again */
+	Event::QuitEvent *l_reused = l_manager.make<Event::QuitEvent>(100);
+	ASSERT_EQUAL("Event::EventManager::make() ARENA RECYCLED",
+	    l_first, l_reused);
+	l_manager.queue(l_reused);
+
+	/* dequeued arena events are reclaimed by the manager */
+	l_manager.dequeue(l_reused);
+	l_manager.execute();
+	l_manager.execute();
+	ASSERT_EQUAL("Event::EventManager::dequeue() ARENA EVENT REMOVED",
+	    100, l_listener.count);
+
+	/* arena events can't be scheduled */
+	Event::QuitEvent *l_future =
+	    l_manager.make<Event::QuitEvent>(101, NOW() + 60.);
+	const bool l_queued = l_manager.queue(l_future);
+	ASSERT_FALSE("Event::EventManager::queue() FUTURE ARENA EVENT REJECTED",
+	    l_queued);
+	l_manager.execute();
+	l_manager.execute();
+	ASSERT_EQUAL("Event::EventManager::queue() FUTURE ARENA EVENT DROPPED",
+	    100, l_listener.count);
+
+	l_manager.disconnect(&l_listener, Event::QuitEvent::Type());
+}
+
+void
+eventmanager_priority_test(void)
+{
+	Event::EventManager l_manager("Test.EventManager");
+	RecordingListener l_listener;
+
+	l_manager.connect(&l_listener, PriorityEvent::Type());
+
+	l_manager.queue(new PriorityEvent(0, Event::IEvent::LowPriority));
+	l_manager.queue(new PriorityEvent(1, Event::IEvent::HighPriority));
+	l_manager.queue(new PriorityEvent(2, Event::IEvent::LowPriority));
+	l_manager.queue(new PriorityEvent(3, Event::IEvent::HighestPriority));
+
+	l_manager.execute();
+	l_manager.execute();
+
+	ASSERT_EQUAL("Event::EventManager::execute() DISPATCHED ALL",
+	    4, l_listener.count);
+	ASSERT_TRUE("Event::EventManager::execute() PRIORITY THEN QUEUE ORDER",
+	    3 == l_listener.tags[0] && 1 == l_listener.tags[1]
+	    && 0 == l_listener.tags[2] && 2 == l_listener.tags[3]);
+
+	l_manager.disconnect(&l_listener, PriorityEvent::Type());
+}
+
+void
+eventmanager_schedule_test(void)
+{
+	Event::EventManager l_manager("Test.EventManager");
+	RecordingListener l_listener;
+
+	l_manager.connect(&l_listener, PriorityEvent::Type());
+
+	const MMTIME l_now = NOW();
+	l_manager.queue(new PriorityEvent(0, Event::IEvent::HighestPriority,
+	    l_now + .10));
+	l_manager.queue(new PriorityEvent(1, Event::IEvent::LowPriority,
+	    l_now + .05));
+	l_manager.queue(new PriorityEvent(2, Event::IEvent::LowPriority));
+
+	l_manager.execute();
+	l_manager.execute();
+	ASSERT_EQUAL("Event::EventManager::execute() SCHEDULED DO NOT BLOCK",
+	    1, l_listener.count);
+	ASSERT_EQUAL("Event::EventManager::execute() IMMEDIATE DISPATCHED",
+	    2, l_listener.tags[0]);
+
+	/* removing a scheduled event */
+	PriorityEvent *l_cancel =
+	    new PriorityEvent(3, Event::IEvent::LowPriority, l_now + .05);
+	l_manager.queue(l_cancel);
+	const bool l_removed = l_manager.dequeue(l_cancel);
+	ASSERT_TRUE("Event::EventManager::dequeue() SCHEDULED EVENT", l_removed);
+	delete l_cancel;
+
+	Core::Platform::Sleep(.06);
+	l_manager.execute();
+	ASSERT_EQUAL("Event::EventManager::execute() FIRST TIMER DUE",
+	    2, l_listener.count);
+	ASSERT_EQUAL("Event::EventManager::execute() FIRST TIMER DISPATCHED",
+	    1, l_listener.tags[1]);
+
+	Core::Platform::Sleep(.06);
+	l_manager.execute();
+	ASSERT_EQUAL("Event::EventManager::execute() SECOND TIMER DUE",
+	    3, l_listener.count);
+	ASSERT_EQUAL("Event::EventManager::execute() SECOND TIMER DISPATCHED",
+	    0, l_listener.tags[2]);
+
+	l_manager.disconnect(&l_listener, PriorityEvent::Type());
+}
+
+struct TypedHandler
+{
+	TypedHandler(void) : quit_code(0), tag(0), count(0) {}
+
+	bool handleQuit(const Event::QuitEvent &e)
+	    { quit_code = e.code(); ++count; return(false); }
+
+	bool handlePriority(const PriorityEvent &e)
+	    { tag = e.tag(); ++count; return(true); }
+
+	int quit_code;
+	int tag;
+	int count;
+};
+
+void
+eventmanager_typed_connect_test(void)
+{
+	Event::EventManager l_manager("Test.EventManager");
+	TypedHandler l_handler;
+	TypedHandler l_other;
+	CountingListener l_listener;
+
+	bool l_result;
+
+	l_result = l_manager.connect(&l_handler, &TypedHandler::handleQuit);
+	ASSERT_TRUE("Event::EventManager::connect<T>() QUIT", l_result);
+
+	l_result = l_manager.connect(&l_handler, &TypedHandler::handlePriority);
+	ASSERT_TRUE("Event::EventManager::connect<T>() PRIORITY", l_result);
+
+	l_result = l_manager.connect(&l_other, &TypedHandler::handleQuit);
+	ASSERT_TRUE("Event::EventManager::connect<T>() OTHER OBJECT", l_result);
+
+	l_result = l_manager.connect(&l_handler, &TypedHandler::handleQuit);
+	ASSERT_FALSE("Event::EventManager::connect<T>() DUPLICATE", l_result);
+
+	l_manager.connect(&l_listener, Event::QuitEvent::Type());
+
+	Event::QuitEvent l_quit(7);
+	l_manager.dispatch(l_quit);
+
+	ASSERT_EQUAL("Event::EventManager::dispatch() TYPED EVENT",
+	    7, l_handler.quit_code);
+	ASSERT_EQUAL("Event::EventManager::dispatch() TYPED OTHER OBJECT",
+	    7, l_other.quit_code);
+	ASSERT_EQUAL("Event::EventManager::dispatch() MIXED LISTENER",
+	    1, l_listener.count);
+
+	PriorityEvent l_priority(3, 0);
+	l_result = l_manager.dispatch(l_priority);
+	ASSERT_TRUE("Event::EventManager::dispatch() TYPED HANDLED", l_result);
+	ASSERT_EQUAL("Event::EventManager::dispatch() TYPED ROUTED",
+	    3, l_handler.tag);
+	ASSERT_ZERO("Event::EventManager::dispatch() TYPED NOT ROUTED",
+	    l_other.tag);
+
+	l_result = l_manager.disconnect(&l_handler, &TypedHandler::handleQuit);
+	ASSERT_TRUE("Event::EventManager::disconnect<T>()", l_result);
+	l_manager.dispatch(l_quit);
+
+	ASSERT_EQUAL("Event::EventManager::dispatch() TYPED DISCONNECTED",
+	    2, l_handler.count);
+	ASSERT_EQUAL("Event::EventManager::dispatch() TYPED STILL CONNECTED",
+	    2, l_other.count);
+
+	l_manager.disconnect(&l_handler, &TypedHandler::handlePriority);
+	l_manager.disconnect(&l_other, &TypedHandler::handleQuit);
+	l_manager.disconnect(&l_listener, Event::QuitEvent::Type());
+}
+
+struct InputHandler
+{
+	InputHandler(void) : count(0), touches(0) {}
+
+	bool handleAxis(const Event::JoystickAxisEvent &e)
+	{
+		if (count < 8) {
+			values[count] = e.value();
+			sources[count] = static_cast<int>(e.source());
+		}
+		++count;
+		return(false);
+	}
+
+	bool handleTouch(const Event::TouchEvent &e)
+	{
+		if (touches < 8)
+			touch_x[touches] = e.x();
+		++touches;
+		return(false);
+	}
+
+	int count;
+	int touches;
+	int values[8];
+	int sources[8];
+	int touch_x[8];
+};
+
+void
+eventmanager_coalesce_test(void)
+{
+	Event::EventManager l_manager("Test.EventManager");
+	InputHandler l_handler;
+
+	l_manager.connect(&l_handler, &InputHandler::handleAxis);
+	l_manager.connect(&l_handler, &InputHandler::handleTouch);
+	l_manager.setCoalescer(Event::JoystickAxisEvent::Type(),
+	    Event::JoystickAxisEvent::CoalesceKey);
+	l_manager.setCoalescer(Event::TouchEvent::Type(),
+	    Event::TouchEvent::CoalesceKey);
+
+	for (int i = 1; i <= 100; ++i) {
+		l_manager.queue(l_manager.make<Event::JoystickAxisEvent>
+		    (Input::Joystick::JSA_X, i, 0, 100, 0));
+		l_manager.queue(new Event::JoystickAxisEvent
+		    (Input::Joystick::JSA_X, -i, 0, 100, 1));
+	}
+	l_manager.queue(new Event::JoystickAxisEvent
+	    (Input::Joystick::JSA_Y, 5, 0, 100, 0));
+
+	l_manager.queue(new Event::TouchEvent(Input::Touch::Press, 0, 0, 0));
+	l_manager.queue(new Event::TouchEvent(Input::Touch::Move, 1, 1, 0));
+	l_manager.queue(new Event::TouchEvent(Input::Touch::Move, 2, 2, 0));
+	l_manager.queue(new Event::TouchEvent(Input::Touch::Release, 2, 2, 0));
+
+	l_manager.execute();
+	l_manager.execute();
+
+	ASSERT_EQUAL("Event::EventManager::setCoalescer() KEEPS ONE PER KEY",
+	    3, l_handler.count);
+	ASSERT_EQUAL("Event::EventManager::setCoalescer() LATEST VALUE",
+	    100, l_handler.values[0]);
+	ASSERT_EQUAL("Event::EventManager::setCoalescer() KEEPS POSITION",
+	    0, l_handler.sources[0]);
+	ASSERT_EQUAL("Event::EventManager::setCoalescer() KEYED BY DEVICE",
+	    -100, l_handler.values[1]);
+	ASSERT_EQUAL("Event::EventManager::setCoalescer() KEYED BY AXIS",
+	    5, l_handler.values[2]);
+	ASSERT_EQUAL("Event::EventManager::setCoalescer() TOUCH MOVES ONLY",
+	    3, l_handler.touches);
+
+	/* latest move never overtakes presses and releases */
+	l_handler.touches = 0;
+	l_manager.queue(new Event::TouchEvent(Input::Touch::Press, 1, 0, 0, 1));
+	l_manager.queue(new Event::TouchEvent(Input::Touch::Move, 2, 0, 0, 2));
+	l_manager.queue(new Event::TouchEvent(Input::Touch::Release, 3, 0, 0, 3));
+	l_manager.queue(new Event::TouchEvent(Input::Touch::Press, 100, 0, 0, 100));
+	l_manager.queue(new Event::TouchEvent(Input::Touch::Move, 101, 0, 0, 101));
+	l_manager.execute();
+	l_manager.execute();
+
+	ASSERT_EQUAL("Event::EventManager::setCoalescer() INTERLEAVED COUNT",
+	    4, l_handler.touches);
+	const bool l_in_order = l_handler.touch_x[0] == 1
+	    && l_handler.touch_x[1] == 3 && l_handler.touch_x[2] == 100
+	    && l_handler.touch_x[3] == 101;
+	ASSERT_TRUE("Event::EventManager::setCoalescer() INTERLEAVED ORDER",
+	    l_in_order);
+
+	/* dequeued events free their coalescing slot */
+	Event::JoystickAxisEvent *l_dequeued = new Event::JoystickAxisEvent
+	    (Input::Joystick::JSA_X, 6, 0, 100, 0);
+	l_manager.queue(l_dequeued);
+	l_manager.dequeue(l_dequeued);
+	delete l_dequeued;
+	l_manager.queue(new Event::JoystickAxisEvent
+	    (Input::Joystick::JSA_X, 7, 0, 100, 0));
+	l_manager.queue(new Event::JoystickAxisEvent
+	    (Input::Joystick::JSA_X, 8, 0, 100, 0));
+	l_manager.execute();
+	l_manager.execute();
+
+	ASSERT_EQUAL("Event::EventManager::dequeue() FREES COALESCING SLOT",
+	    4, l_handler.count);
+	ASSERT_EQUAL("Event::EventManager::dequeue() COALESCES NEWER EVENTS",
+	    8, l_handler.values[3]);
+
+	/* many keys, one event each */
+	for (int r = 0; r < 2; ++r)
+		for (int i = 0; i < 1000; ++i)
+			l_manager.queue(l_manager.make<Event::JoystickAxisEvent>
+			    (Input::Joystick::JSA_X, r, 0, 100,
+			     static_cast<size_t>(i)));
+	l_manager.execute();
+	l_manager.execute();
+
+	ASSERT_EQUAL("Event::EventManager::setCoalescer() MANY KEYS",
+	    1004, l_handler.count);
+
+	/* policy removed, nothing coalesced */
+	l_manager.setCoalescer(Event::JoystickAxisEvent::Type(), 0);
+	for (int i = 0; i < 4; ++i)
+		l_manager.queue(new Event::JoystickAxisEvent
+		    (Input::Joystick::JSA_X, i, 0, 100, 0));
+	l_manager.execute();
+	l_manager.execute();
+
+	ASSERT_EQUAL("Event::EventManager::setCoalescer() REMOVED",
+	    1008, l_handler.count);
+}
+
+struct SlowListener : public Event::IEventListener
+{
+	virtual bool handleEvent(const Event::IEvent &)
+	    { Core::Platform::Sleep(.002); return(true); }
+};
+
+void
+eventmanager_stats_test(void)
+{
+	Event::EventManager l_manager("Test.EventManager");
+	SlowListener l_slow;
+	CountingListener l_counting;
+
+	l_manager.connect(&l_counting, Event::QuitEvent::Type());
+	l_manager.connect(&l_slow, PriorityEvent::Type());
+
+	/* disabled by default */
+	l_manager.queue(new Event::QuitEvent(0));
+	l_manager.execute();
+	l_manager.execute();
+	ASSERT_ZERO("Event::EventManager::stats() DISABLED",
+	    l_manager.stats().type_count);
+
+	l_manager.setStatsEnabled(true);
+	for (int i = 0; i < 3; ++i)
+		l_manager.queue(new Event::QuitEvent(i));
+	l_manager.queue(new PriorityEvent(0, 0));
+
+	Event::EventManager::Stats l_stats = l_manager.stats();
+	ASSERT_EQUAL("Event::EventManager::stats() QUEUE DEPTH",
+	    4, static_cast<int>(l_stats.queue_depth));
+	ASSERT_EQUAL("Event::EventManager::stats() QUEUE PEAK",
+	    4, static_cast<int>(l_stats.queue_peak));
+
+	l_manager.execute();
+	l_manager.execute();
+
+	l_stats = l_manager.stats();
+	ASSERT_EQUAL("Event::EventManager::stats() TYPES",
+	    2, static_cast<int>(l_stats.type_count));
+
+	const Event::EventManager::TypeStats *l_quit = 0;
+	const Event::EventManager::TypeStats *l_priority = 0;
+	for (size_t i = 0; i < l_stats.type_count; ++i)
+		if (l_stats.types[i].type == Event::QuitEvent::Type())
+			l_quit = &l_stats.types[i];
+		else if (l_stats.types[i].type == PriorityEvent::Type())
+			l_priority = &l_stats.types[i];
+
+	ASSERT_TRUE("Event::EventManager::stats() TYPE FOUND",
+	    l_quit != 0 && l_priority != 0);
+	if (!l_quit || !l_priority)
+		return;
+
+	ASSERT_EQUAL("Event::EventManager::stats() QUEUED", 3u, l_quit->queued);
+	ASSERT_EQUAL("Event::EventManager::stats() DISPATCHED",
+	    3u, l_quit->dispatched);
+	ASSERT_ZERO("Event::EventManager::stats() NOT HANDLED", l_quit->handled);
+	ASSERT_EQUAL("Event::EventManager::stats() HANDLED",
+	    1u, l_priority->handled);
+	ASSERT_TRUE("Event::EventManager::stats() LATENCY",
+	    l_quit->latency_max >= 0 && l_quit->latency >= l_quit->latency_max);
+
+	const Event::EventManager::ListenerStats *l_listener = 0;
+	for (size_t i = 0; i < l_stats.listener_count; ++i)
+		if (l_stats.listeners[i].listener == &l_slow)
+			l_listener = &l_stats.listeners[i];
+
+	ASSERT_TRUE("Event::EventManager::stats() LISTENER FOUND",
+	    l_listener != 0);
+	if (!l_listener)
+		return;
+
+	ASSERT_EQUAL("Event::EventManager::stats() LISTENER CALLS",
+	    1u, l_listener->calls);
+	ASSERT_TRUE("Event::EventManager::stats() LISTENER TIME",
+	    l_listener->time >= .001);
+
+	l_manager.resetStats();
+	l_stats = l_manager.stats();
+	ASSERT_ZERO("Event::EventManager::resetStats() COUNTERS",
+	    l_stats.types[0].dispatched);
+	ASSERT_ZERO("Event::EventManager::resetStats() PEAK",
+	    l_stats.queue_peak);
+
+	l_manager.disconnect(&l_counting, Event::QuitEvent::Type());
+	l_manager.disconnect(&l_slow, PriorityEvent::Type());
+}
+
+struct TallyListener : public Event::IEventListener
+{
+	TallyListener(void) : count(0) {}
+
+	virtual bool handleEvent(const Event::IEvent &)
+	    { ++count; return(false); }
+
+	int count;
+};
+
+struct KeyHandler
+{
+	KeyHandler(void) : count(0), handled(false) {}
+
+	bool handleKey(const Event::KeyboardEvent &)
+	    { ++count; return(handled); }
+
+	int count;
+	bool handled;
+};
+
+void
+eventmanager_keyed_test(void)
+{
+	Event::EventManager l_manager("Test.EventManager");
+	KeyHandler l_space;
+	KeyHandler l_escape;
+	KeyHandler l_any;
+	TallyListener l_listener;
+	bool l_result;
+
+	l_result = l_manager.connect(&l_space, &KeyHandler::handleKey,
+	    Input::Keyboard::KBK_SPACE);
+	ASSERT_FALSE("Event::EventManager::connect() KEYED NEEDS KEY FUNCTION",
+	    l_result);
+
+	l_manager.setKeyFunction(Event::KeyboardEvent::Type(),
+	    Event::KeyboardEvent::SubscriptionKey);
+
+	l_result = l_manager.connect(&l_space, &KeyHandler::handleKey,
+	    Input::Keyboard::KBK_SPACE);
+	ASSERT_TRUE("Event::EventManager::connect() KEYED", l_result);
+	l_manager.connect(&l_escape, &KeyHandler::handleKey,
+	    Input::Keyboard::KBK_ESCAPE);
+	l_manager.connect(&l_any, &KeyHandler::handleKey);
+	l_manager.connect(&l_listener, Event::KeyboardEvent::Type(),
+	    Input::Keyboard::KBK_SPACE);
+
+	Event::KeyboardEvent l_event(Input::Keyboard::KBK_SPACE,
+	    Input::Keyboard::KeyPressed, 0);
+	l_manager.dispatch(l_event);
+
+	ASSERT_EQUAL("Event::EventManager::dispatch() KEYED MATCH",
+	    1, l_space.count);
+	ASSERT_EQUAL("Event::EventManager::dispatch() KEYED LISTENER MATCH",
+	    1, l_listener.count);
+	ASSERT_ZERO("Event::EventManager::dispatch() KEYED SKIPPED",
+	    l_escape.count);
+	ASSERT_EQUAL("Event::EventManager::dispatch() UNKEYED",
+	    1, l_any.count);
+
+	/* keyed listeners go first */
+	l_space.handled = true;
+	l_manager.dispatch(l_event);
+	ASSERT_EQUAL("Event::EventManager::dispatch() KEYED FIRST",
+	    1, l_any.count);
+
+	l_result = l_manager.disconnect(&l_space, &KeyHandler::handleKey,
+	    Input::Keyboard::KBK_SPACE);
+	ASSERT_TRUE("Event::EventManager::disconnect() KEYED", l_result);
+	l_manager.dispatch(l_event);
+	ASSERT_EQUAL("Event::EventManager::dispatch() KEYED DISCONNECTED",
+	    2, l_space.count);
+	ASSERT_EQUAL("Event::EventManager::dispatch() UNKEYED AGAIN",
+	    2, l_any.count);
+
+	l_manager.disconnect(&l_escape, &KeyHandler::handleKey,
+	    Input::Keyboard::KBK_ESCAPE);
+	l_manager.disconnect(&l_any, &KeyHandler::handleKey);
+	l_manager.disconnect(&l_listener, Event::KeyboardEvent::Type(),
+	    Input::Keyboard::KBK_SPACE);
+}
+
+void
+eventmanager_budget_test(void)
+{
+	Event::EventManager l_manager("Test.EventManager");
+	RecordingListener l_listener;
+	bool l_result;
+
+	l_manager.connect(&l_listener, PriorityEvent::Type());
+	l_manager.setBudget(0, 2);
+
+	for (int i = 0; i < 5; ++i)
+		l_manager.queue(l_manager.make<PriorityEvent>
+		    (i, static_cast<uint8_t>(0)));
+	l_manager.execute();
+
+	l_result = l_manager.execute();
+	ASSERT_FALSE("Event::EventManager::execute() BUDGET USED", l_result);
+	ASSERT_EQUAL("Event::EventManager::execute() BUDGET COUNT",
+	    2, l_listener.count);
+	ASSERT_EQUAL("Event::EventManager::backlog()",
+	    3, static_cast<int>(l_manager.backlog()));
+
+	/* new events wait for the backlog */
+	l_manager.queue(l_manager.make<PriorityEvent>
+	    (5, static_cast<uint8_t>(0)));
+
+	l_manager.execute();
+	l_result = l_manager.execute();
+	ASSERT_TRUE("Event::EventManager::execute() BACKLOG DONE", l_result);
+	ASSERT_EQUAL("Event::EventManager::execute() BACKLOG COUNT",
+	    5, l_listener.count);
+	ASSERT_EQUAL("Event::EventManager::execute() BACKLOG ORDER",
+	    4, l_listener.tags[4]);
+	ASSERT_ZERO("Event::EventManager::backlog() EMPTY",
+	    l_manager.backlog());
+
+	l_manager.execute();
+	ASSERT_EQUAL("Event::EventManager::execute() AFTER BACKLOG",
+	    5, l_listener.tags[5]);
+
+	/* time budget always makes progress */
+	l_manager.setBudget(1e-9);
+	for (int i = 0; i < 2; ++i)
+		l_manager.queue(l_manager.make<PriorityEvent>
+		    (i, static_cast<uint8_t>(0)));
+	l_manager.execute();
+	l_manager.execute();
+	ASSERT_EQUAL("Event::EventManager::execute() TIME BUDGET PROGRESS",
+	    7, l_listener.count);
+	ASSERT_TRUE("Event::EventManager::setBudget() TIME",
+	    l_manager.budgetTime() > 1e-9 - 1e-15
+	    && l_manager.budgetTime() < 1e-9 + 1e-15);
+
+	l_manager.disconnect(&l_listener, PriorityEvent::Type());
+}
+
+void
+eventmanager_dispatch_mutation_test(void)
+{
+	Event::EventManager l_manager("Test.EventManager");
+	MutatingListener l_first;
+	CountingListener l_second;
+	CountingListener l_third;
+	CountingListener l_late;
+
+	l_manager.connect(&l_first, Event::QuitEvent::Type());
+	l_manager.connect(&l_second, Event::QuitEvent::Type());
+	l_manager.connect(&l_third, Event::QuitEvent::Type());
+
+	l_first.manager = &l_manager;
+	l_first.disconnect = &l_second;
+	l_first.connect = &l_late;
+
+	Event::QuitEvent l_event(0);
+	l_manager.dispatch(l_event);
+
+	ASSERT_EQUAL("Event::EventManager::dispatch() FIRST CALLED",
+	    1, l_first.count);
+	ASSERT_ZERO("Event::EventManager::dispatch() DISCONNECTED SKIPPED",
+	    l_second.count);
+	ASSERT_EQUAL("Event::EventManager::dispatch() DELIVERY NOT ABORTED",
+	    1, l_third.count);
+	ASSERT_ZERO("Event::EventManager::dispatch() CONNECTED WAITS",
+	    l_late.count);
+
+	l_manager.dispatch(l_event);
+
+	ASSERT_ZERO("Event::EventManager::dispatch() STAYS DISCONNECTED",
+	    l_second.count);
+	ASSERT_EQUAL("Event::EventManager::dispatch() CONNECTED RECEIVES",
+	    1, l_late.count);
+
+	l_manager.disconnect(&l_first, Event::QuitEvent::Type());
+	l_manager.disconnect(&l_third, Event::QuitEvent::Type());
+	l_manager.disconnect(&l_late, Event::QuitEvent::Type());
+}
+
+TESTS_BEGIN
+	TEST(eventmanager_serial_queue_test)
+	TEST(eventmanager_concurrent_queue_test)
+	TEST(eventmanager_arena_test)
+	TEST(eventmanager_priority_test)
+	TEST(eventmanager_schedule_test)
+	TEST(eventmanager_dispatch_mutation_test)
+	TEST(eventmanager_typed_connect_test)
+	TEST(eventmanager_coalesce_test)
+	TEST(eventmanager_stats_test)
+	TEST(eventmanager_keyed_test)
+	TEST(eventmanager_budget_test)
+TESTS_END
+
@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#include "core/bufferio.h"
+#include "core/identifier.h"
+#include "core/type.h"
+
+#include "event/eventmanager.h"
+#include "event/eventplayer.h"
+#include "event/eventrecorder.h"
+#include "event/keyboardevent.h"
+#include "event/sensorevent.h"
+#include "event/touchevent.h"
+#include "event/updateevent.h"
+
+#include "tests/common.h"
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+MARSHMALLOW_NAMESPACE_USE
+
+struct ReplayHandler
+{
+	ReplayHandler(void)
+	    : keys(0)
+	    , touches(0)
+	    , sensors(0)
+	    , key_step(-1)
+	    , touch_step(-1)
+	    , touch_x(0)
+	    , sensor_z(0)
+	    , step(0)
+	{}
+
+	bool handleKeyboard(const Event::KeyboardEvent &e)
+	{
+		++keys;
+		key_step = step;
+		pressed = (Input::Keyboard::KeyPressed == e.action());
+		return(false);
+	}
+
+	bool handleTouch(const Event::TouchEvent &e)
+	    { ++touches; touch_step = step; touch_x = e.x(); return(false); }
+
+	bool handleSensor(const Event::SensorEvent &e)
+	    { ++sensors; sensor_z = e.z(); return(false); }
+
+	int keys;
+	int touches;
+	int sensors;
+	int key_step;
+	int touch_step;
+	int touch_x;
+	float sensor_z;
+	int step;
+	bool pressed;
+};
+
+struct HandlingListener : public Event::IEventListener
+{
+	HandlingListener(void) : count(0) {}
+
+	virtual bool handleEvent(const Event::IEvent &)
+	    { ++count; return(true); }
+
+	int count;
+};
+
+struct KeyListener : public Event::IEventListener
+{
+	KeyListener(void) : count(0) {}
+
+	virtual bool handleEvent(const Event::IEvent &)
+	    { ++count; return(false); }
+
+	int count;
+};
+
+/* tracks input state the way the engine does */
+struct StatePlayer : public Event::EventPlayer
+{
+	StatePlayer(Core::IDataIO *input, Event::EventManager *manager,
+	    const KeyListener &keys)
+	    : EventPlayer(input, manager)
+	    , listener(keys)
+	    , applied(0)
+	    , dispatched(-1)
+	{}
+
+	virtual void apply(const Event::InputEvent &)
+	    { ++applied; dispatched = listener.count; }
+
+	const KeyListener &listener;
+	int applied;
+	int dispatched;
+};
+
+void
+eventrecorder_replay_test(void)
+{
+	char l_data[1024];
+	long l_size;
+
+	/* record */
+	{
+		Event::EventManager l_manager("Test.EventManager");
+		Core::BufferIO l_output(l_data, sizeof(l_data));
+		Event::EventRecorder l_recorder(&l_output, &l_manager);
+
+		/* handled events get recorded too */
+		HandlingListener l_handling;
+		l_manager.connect(&l_handling, Event::KeyboardEvent::Type());
+
+		l_recorder.setStep(1);
+		l_manager.dispatch(Event::UpdateEvent(1.f / 60.f));
+		l_manager.dispatch(Event::KeyboardEvent(Input::Keyboard::KBK_A,
+		    Input::Keyboard::KeyPressed, 0));
+		l_recorder.setStep(2);
+		l_manager.dispatch(Event::TouchEvent(Input::Touch::Move, 42, 7, 1));
+		l_manager.dispatch(Event::SensorEvent(Input::Sensor::Gravity,
+		    0.f, 0.f, -9.8f, 2));
+		l_manager.dispatch(Event::UpdateEvent(1.f / 60.f));
+
+		ASSERT_EQUAL("Event::EventRecorder RECORDS HANDLED EVENTS",
+		    1, l_handling.count);
+
+		l_manager.disconnect(&l_handling, Event::KeyboardEvent::Type());
+
+		ASSERT_EQUAL("Event::EventRecorder::count()",
+		    3, static_cast<int>(l_recorder.count()));
+		ASSERT_TRUE("Event::EventRecorder::flush()", l_recorder.flush());
+
+		l_size = l_output.tell();
+	}
+
+	/* replay */
+	Event::EventManager l_manager("Test.EventManager");
+	ReplayHandler l_handler;
+
+	l_manager.connect(&l_handler, &ReplayHandler::handleKeyboard);
+	l_manager.connect(&l_handler, &ReplayHandler::handleTouch);
+	l_manager.connect(&l_handler, &ReplayHandler::handleSensor);
+
+	Core::BufferIO l_input(static_cast<const void *>(l_data),
+	    static_cast<size_t>(l_size));
+	Event::EventPlayer l_player(&l_input, &l_manager);
+
+	ASSERT_TRUE("Event::EventPlayer::isValid()", l_player.isValid());
+	ASSERT_EQUAL("Event::EventPlayer::count()",
+	    3, static_cast<int>(l_player.count()));
+
+	/*
+	 * Same loop as the engine, playback advances ahead of every step and
+	 * frames run a varying number of them.
+	 */
+	uint32_t l_step = 0;
+	for (int i = 0; i < 3; ++i) {
+		l_manager.execute();
+
+		for (int j = 0; j < i; ++j) {
+			l_handler.step = static_cast<int>(l_step);
+			l_player.setStep(l_step++);
+			l_manager.dispatch(Event::UpdateEvent(1.f / 120.f));
+		}
+	}
+
+	ASSERT_TRUE("Event::EventPlayer::isFinished()", l_player.isFinished());
+	ASSERT_EQUAL("Event::EventPlayer::step()",
+	    2, static_cast<int>(l_player.step()));
+
+	ASSERT_EQUAL("Event::EventPlayer REPLAYED KEYBOARD", 1, l_handler.keys);
+	ASSERT_TRUE("Event::EventPlayer REPLAYED KEYBOARD ACTION",
+	    l_handler.pressed);
+	ASSERT_EQUAL("Event::EventPlayer REPLAYED KEYBOARD STEP",
+	    1, l_handler.key_step);
+	ASSERT_EQUAL("Event::EventPlayer REPLAYED TOUCH", 1, l_handler.touches);
+	ASSERT_EQUAL("Event::EventPlayer REPLAYED TOUCH STEP",
+	    2, l_handler.touch_step);
+	ASSERT_EQUAL("Event::EventPlayer REPLAYED TOUCH PAYLOAD",
+	    42, l_handler.touch_x);
+	ASSERT_EQUAL("Event::EventPlayer REPLAYED SENSOR", 1, l_handler.sensors);
+	ASSERT_TRUE("Event::EventPlayer REPLAYED SENSOR PAYLOAD",
+	    l_handler.sensor_z > -9.8f - 1e-6f
+	    && l_handler.sensor_z < -9.8f + 1e-6f);
+}
+
+void
+eventplayer_live_input_test(void)
+{
+	char l_data[256];
+	long l_size;
+
+	{
+		Event::EventManager l_manager("Test.EventManager");
+		Core::BufferIO l_output(l_data, sizeof(l_data));
+		Event::EventRecorder l_recorder(&l_output, &l_manager);
+		l_recorder.setStep(1);
+		l_manager.dispatch(Event::KeyboardEvent(Input::Keyboard::KBK_A,
+		    Input::Keyboard::KeyPressed, 0));
+		l_recorder.flush();
+		l_size = l_output.tell();
+	}
+
+	Event::EventManager l_manager("Test.EventManager");
+	KeyListener l_keys;
+	l_manager.connect(&l_keys, Event::KeyboardEvent::Type());
+	l_manager.connect(&l_keys, Event::UpdateEvent::Type());
+
+	Core::BufferIO l_input(static_cast<const void *>(l_data),
+	    static_cast<size_t>(l_size));
+	StatePlayer l_player(&l_input, &l_manager, l_keys);
+	ASSERT_TRUE("Event::EventPlayer::isValid() LIVE", l_player.isValid());
+
+	/* live input is dropped, everything else goes through */
+	l_manager.dispatch(Event::KeyboardEvent(Input::Keyboard::KBK_B,
+	    Input::Keyboard::KeyPressed, 0));
+	l_manager.queue(new Event::KeyboardEvent(Input::Keyboard::KBK_B,
+	    Input::Keyboard::KeyReleased, 0));
+	l_manager.execute();
+	l_manager.dispatch(Event::UpdateEvent(1.f / 60.f));
+	ASSERT_EQUAL("Event::EventPlayer LIVE INPUT DROPPED", 1, l_keys.count);
+
+	/* replayed input gets applied first, then dispatched */
+	l_player.setStep(0);
+	l_player.setStep(1);
+	ASSERT_EQUAL("Event::EventPlayer REPLAYED", 2, l_keys.count);
+	ASSERT_TRUE("Event::EventPlayer::apply() BEFORE DISPATCH",
+	    1 == l_player.applied && 1 == l_player.dispatched);
+
+	/* live input is back once finished */
+	ASSERT_TRUE("Event::EventPlayer::isFinished() LIVE",
+	    l_player.isFinished());
+	l_manager.dispatch(Event::KeyboardEvent(Input::Keyboard::KBK_B,
+	    Input::Keyboard::KeyPressed, 0));
+	ASSERT_EQUAL("Event::EventPlayer LIVE INPUT RESTORED", 3, l_keys.count);
+	ASSERT_TRUE("Event::EventManager::filter() CLEARED",
+	    0 == l_manager.filter());
+
+	l_manager.disconnect(&l_keys, Event::UpdateEvent::Type());
+	l_manager.disconnect(&l_keys, Event::KeyboardEvent::Type());
+}
+
+void
+eventplayer_invalid_test(void)
+{
+	const char l_garbage[] = "not an event recording";
+	Event::EventManager l_manager("Test.EventManager");
+	Core::BufferIO l_input(static_cast<const void *>(l_garbage),
+	    sizeof(l_garbage));
+	Event::EventPlayer l_player(&l_input, &l_manager);
+
+	ASSERT_FALSE("Event::EventPlayer::isValid() INVALID", l_player.isValid());
+	ASSERT_TRUE("Event::EventPlayer::isFinished() INVALID",
+	    l_player.isFinished());
+}
+
+TESTS_BEGIN
+	TEST(eventrecorder_replay_test)
+	TEST(eventplayer_live_input_test)
+	TEST(eventplayer_invalid_test)
+TESTS_END
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#include "core/identifier.h"
+#include "core/platform.h"
+#include "core/thread.h"
+#include "core/type.h"
+
+#include "event/eventmanager.h"
+#include "event/ieventlistener.h"
+#include "event/quitevent.h"
+
+#include "tests/common.h"
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+/*
+ * Concurrent queue stress benchmark
+ *
+ * Posts a fixed amount of events split between 1 to 8 producer threads
+ * while the main thread keeps executing the event manager, throughput is
+ * measured from the first post until the last event is dispatched.
+ */
+
+MARSHMALLOW_NAMESPACE_USE
+
+#define BENCH_PRODUCERS_MAX 8
+#define BENCH_EVENTS        400000
+
+struct CountingListener : public Event::IEventListener
+{
+	CountingListener(void) : count(0) {}
+
+	virtual bool handleEvent(const Event::IEvent &)
+	    { ++count; return(false); }
+
+	int count;
+};
+
+struct Producer
+{
+	Event::EventManager *manager;
+	int events;
+};
+
+static void
+producer_proc(void *data)
+{
+	Producer *l_producer = static_cast<Producer *>(data);
+
+	for (int i = 0; i < l_producer->events; ++i)
+		l_producer->manager->queue(new Event::QuitEvent(i));
+}
+
+void
+queue_throughput_benchmark(void)
+{
+	Core::Platform::Initialize();
+
+	fprintf(stderr, "%-10s %-10s %-12s %-14s\n",
+	    "PRODUCERS", "EVENTS", "SECONDS", "EVENTS/SECOND");
+
+	for (int p = 1; p <= BENCH_PRODUCERS_MAX; ++p) {
+		Event::EventManager l_manager("Bench.EventManager",
+		    Event::EventManager::ConcurrentQueue);
+		CountingListener l_listener;
+		l_manager.connect(&l_listener, Event::QuitEvent::Type());
+
+		Producer l_producer[BENCH_PRODUCERS_MAX];
+		Core::Thread *l_thread[BENCH_PRODUCERS_MAX];
+
+		const int l_per_producer = BENCH_EVENTS / p;
+		const int l_total = l_per_producer * p;
+
+		const MMTIME l_start = NOW();
+
+		for (int i = 0; i < p; ++i) {
+			l_producer[i].manager = &l_manager;
+			l_producer[i].events = l_per_producer;
+			l_thread[i] = new Core::Thread(producer_proc, &l_producer[i]);
+			l_thread[i]->start();
+		}
+
+		while (l_listener.count < l_total)
+			l_manager.execute();
+
+		const MMTIME l_elapsed = NOW() - l_start;
+
+		for (int i = 0; i < p; ++i)
+			delete l_thread[i];
+
+		fprintf(stderr, "%-10d %-10d %-12.4f %-14.0f\n",
+		    p, l_total, l_elapsed, l_total / l_elapsed);
+
+		ASSERT_EQUAL("Event::EventManager ALL EVENTS DISPATCHED",
+		    l_total, l_listener.count);
+
+		l_manager.disconnect(&l_listener, Event::QuitEvent::Type());
+	}
+
+	Core::Platform::Finalize();
+}
+
+TESTS_BEGIN
+	TEST(queue_throughput_benchmark)
+TESTS_END
+
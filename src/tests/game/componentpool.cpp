@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#include "core/identifier.h"
+#include "core/type.h"
+
+#include "game/componentpool.h"
+#include "game/entity.h"
+#include "game/entityscenelayer.h"
+#include "game/factory.h"
+#include "game/movementcomponent.h"
+#include "game/positioncomponent.h"
+
+#include "tests/common.h"
+
+#include <cstdlib>
+#include <new>
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+MARSHMALLOW_NAMESPACE_USE
+
+namespace {
+	size_t s_allocations(0);
+}
+
+void *
+operator new(size_t size) throw(std::bad_alloc)
+{
+	++s_allocations;
+	void *l_ptr = malloc(size ? size : 1);
+	if (!l_ptr) abort();
+	return(l_ptr);
+}
+
+void
+operator delete(void *ptr) throw()
+{
+	free(ptr);
+}
+
+void
+componentpool_dense_test(void)
+{
+	typedef Game::ComponentPool<Game::PositionComponent> PositionPool;
+
+	/* tiny chunks, slots get spread over several of them */
+	PositionPool l_pool(2);
+
+	Game::PositionComponent *l_components[5];
+	for (int i = 0; i < 5; ++i)
+		l_components[i] = l_pool.create("position", 0);
+
+	ASSERT_TRUE("Game::ComponentPool::create()", l_pool.size() == 5);
+	ASSERT_TRUE("Game::ComponentPool::capacity()", l_pool.capacity() == 6);
+
+	bool l_owned = true;
+	for (int i = 0; i < 5; ++i)
+		l_owned = l_owned && l_pool.owns(l_components[i]);
+	ASSERT_TRUE("Game::ComponentPool::owns()", l_owned);
+
+	Game::PositionComponent l_foreign("position", 0);
+	ASSERT_FALSE("Game::ComponentPool::owns() FOREIGN",
+	    l_pool.owns(&l_foreign));
+	const bool l_foreign_released = l_pool.release(&l_foreign);
+	ASSERT_FALSE("Game::ComponentPool::release() FOREIGN",
+	    l_foreign_released);
+
+	/* release from the middle, last one takes its place */
+	const bool l_released = l_pool.release(l_components[1]);
+	ASSERT_TRUE("Game::ComponentPool::release()", l_released);
+	ASSERT_TRUE("Game::ComponentPool::release() DENSE",
+	    l_pool.size() == 4 && l_pool.at(1) == l_components[4]);
+
+	/* freed slot gets reused */
+	Game::PositionComponent *l_reused = l_pool.create("position", 0);
+	ASSERT_TRUE("Game::ComponentPool::create() REUSE",
+	    l_reused == l_components[1] && l_pool.capacity() == 6);
+
+	const bool l_last_released = l_pool.release(l_components[4]);
+	ASSERT_TRUE("Game::ComponentPool::release() LAST",
+	    l_last_released && l_pool.size() == 4 &&
+	    l_pool.at(1) == l_reused);
+}
+
+void
+componentpool_state_test(void)
+{
+	Game::ComponentPool<Game::MovementComponent> l_pool(4);
+	l_pool.reserve(4);
+
+	const Core::Identifier l_id("movement");
+
+	/* identifier copy is the only allocation left */
+	size_t l_before = s_allocations;
+	{ Core::Identifier l_copy(l_id); }
+	const size_t l_identifier = s_allocations - l_before;
+
+	l_before = s_allocations;
+	Game::MovementComponent *l_first = l_pool.create(l_id, 0);
+	const size_t l_pooled = s_allocations - l_before;
+	ASSERT_EQUAL("Game::ComponentPool::create() STATE IN SLOT",
+	    l_identifier, l_pooled);
+
+	l_before = s_allocations;
+	delete new Game::MovementComponent(l_id, 0);
+	const size_t l_heap = s_allocations - l_before;
+	ASSERT_TRUE("Game::ComponentPool::create() HEAP HAS MORE",
+	    l_heap > l_pooled);
+
+	/* neighbours keep their own state */
+	Game::MovementComponent *l_second = l_pool.create(l_id, 0);
+	l_first->setVelocity(1.f, 2.f);
+	l_second->setVelocity(3.f, 4.f);
+	ASSERT_TRUE("Game::ComponentPool::create() STATE SEPARATE",
+	    l_first->velocityX() == 1.f && l_second->velocityX() == 3.f);
+
+	/* reused slots get freshly constructed state */
+	l_pool.release(l_first);
+	Game::MovementComponent *l_reused = l_pool.create(l_id, 0);
+	ASSERT_TRUE("Game::ComponentPool::create() STATE REUSED",
+	    l_reused == l_first && l_reused->velocityX() == 0.f);
+	ASSERT_TRUE("Game::ComponentPool::create() STATE KEPT",
+	    l_second->velocityY() == 4.f);
+}
+
+void
+componentpool_factory_test(void)
+{
+	Game::Factory l_factory;
+	Game::EntitySceneLayer l_layer("layer", 0);
+
+	Game::ComponentPool<Game::PositionComponent> *l_pool =
+	    new Game::ComponentPool<Game::PositionComponent>;
+	l_layer.addComponentPool(l_pool);
+
+	Game::Entity *l_entity = new Game::Entity("entity", &l_layer);
+
+	/* factory uses the layer pool */
+	Game::IComponent *l_position = l_factory.createComponent
+	    (Game::PositionComponent::Type(), "position", l_entity);
+	ASSERT_TRUE("Game::Factory::createComponent() POOLED",
+	    l_position && l_pool->size() == 1 && l_pool->owns(l_position));
+	l_entity->addComponent(l_position);
+
+	/* types without a pool are heap allocated */
+	Game::IComponent *l_movement = l_factory.createComponent
+	    (Game::MovementComponent::Type(), "movement", l_entity);
+	ASSERT_TRUE("Game::Factory::createComponent() UNPOOLED",
+	    l_movement && l_pool->size() == 1);
+	l_entity->addComponent(l_movement);
+
+	/* entity hands pooled components back */
+	delete l_entity;
+	ASSERT_TRUE("Game::Entity RELEASES POOLED", l_pool->size() == 0);
+}
+
+TESTS_BEGIN
+	TEST(componentpool_dense_test)
+	TEST(componentpool_state_test)
+	TEST(componentpool_factory_test)
+TESTS_END
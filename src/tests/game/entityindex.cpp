@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#include "core/identifier.h"
+
+#include "game/entity.h"
+#include "game/entityscenelayer.h"
+
+#include "tests/common.h"
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+MARSHMALLOW_NAMESPACE_USE
+
+void
+entityindex_layer_test(void)
+{
+	Game::EntitySceneLayer l_layer("layer", 0);
+
+	Game::Entity *l_first = new Game::Entity("same", &l_layer);
+	Game::Entity *l_second = new Game::Entity("same", &l_layer);
+	Game::Entity *l_third = new Game::Entity("same", &l_layer);
+
+	l_layer.addEntity(l_first);
+	l_layer.addEntity(l_second);
+	l_layer.addEntity(l_third);
+
+	/* duplicates are rejected */
+	l_layer.addEntity(l_second);
+	ASSERT_TRUE("Game::EntitySceneLayer::addEntity() DUPLICATE",
+	    l_layer.getEntities().size() == 3);
+
+	ASSERT_TRUE("Game::EntitySceneLayer::getEntity() FIRST",
+	    l_layer.getEntity("same") == l_first);
+
+	/* next entity sharing the identifier takes over */
+	l_layer.removeEntity(l_first);
+	ASSERT_TRUE("Game::EntitySceneLayer::removeEntity() FIRST",
+	    l_layer.getEntity("same") == l_second);
+
+	l_layer.removeEntity(l_third);
+	ASSERT_TRUE("Game::EntitySceneLayer::removeEntity() LAST",
+	    l_layer.getEntity("same") == l_second);
+
+	/* readded entities join the end of the chain */
+	l_layer.addEntity(l_first);
+	Game::IEntity *l_removed = l_layer.removeEntity("same");
+	ASSERT_TRUE("Game::EntitySceneLayer::removeEntity() IDENTIFIER",
+	    l_removed == l_second && l_layer.getEntity("same") == l_first);
+
+	l_layer.removeEntity(l_first);
+	ASSERT_TRUE("Game::EntitySceneLayer::removeEntity() ALL",
+	    !l_layer.getEntity("same") && l_layer.getEntities().empty());
+
+	delete l_first;
+	delete l_second;
+	delete l_third;
+}
+
+TESTS_BEGIN
+	TEST(entityindex_layer_test)
+TESTS_END
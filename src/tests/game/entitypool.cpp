@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#include "core/identifier.h"
+#include "core/type.h"
+
+#include "math/point2.h"
+#include "math/vector2.h"
+
+#include "game/animationcomponent.h"
+#include "game/componentpool.h"
+#include "game/entity.h"
+#include "game/entitypool.h"
+#include "game/entityscenelayer.h"
+#include "game/factory.h"
+#include "game/movementcomponent.h"
+#include "game/positioncomponent.h"
+
+#include "tests/common.h"
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+MARSHMALLOW_NAMESPACE_USE
+
+namespace {
+	typedef Game::ComponentPool<Game::PositionComponent> PositionPool;
+
+	size_t s_pool_left(static_cast<size_t>(-1));
+
+	/* reports components still alive when the pool goes away */
+	struct WatchedPool : public PositionPool
+	{
+		virtual ~WatchedPool(void)
+		    { s_pool_left = size(); }
+	};
+
+	template <class T>
+	T *
+	ComponentOf(Game::Entity *entity)
+	{
+		return(static_cast<T *>(entity->getComponentType(T::Type())));
+	}
+}
+
+void
+entitypool_recycle_test(void)
+{
+	Game::Factory l_factory;
+	Game::EntitySceneLayer l_layer("layer", 0);
+
+	Game::EntityPool *l_pool = new Game::EntityPool("bullet", &l_layer);
+	l_layer.addEntityPool(l_pool);
+	l_pool->addComponent(Game::PositionComponent::Type(), "position");
+	l_pool->addComponent(Game::MovementComponent::Type(), "movement");
+	l_pool->addComponent(Game::AnimationComponent::Type(), "animation");
+	l_pool->reserve(2);
+
+	ASSERT_TRUE("Game::EntityPool::reserve()",
+	    l_pool->size() == 2 && l_pool->available() == 2 &&
+	    l_layer.getEntities().empty());
+
+	Game::Entity *l_entity = l_pool->acquire();
+	ASSERT_TRUE("Game::EntityPool::acquire()",
+	    l_entity && l_pool->available() == 1 &&
+	    l_layer.getEntity("bullet") == l_entity);
+
+	Game::PositionComponent *l_position =
+	    ComponentOf<Game::PositionComponent>(l_entity);
+	Game::MovementComponent *l_movement =
+	    ComponentOf<Game::MovementComponent>(l_entity);
+	Game::AnimationComponent *l_animation =
+	    ComponentOf<Game::AnimationComponent>(l_entity);
+
+	l_position->setPosition(5.f, 6.f);
+	l_movement->setVelocity(1.f, 2.f);
+	l_movement->setAcceleration(Math::Vector2(3.f, 4.f));
+	l_animation->pushFrame("idle", 0);
+	l_animation->play("idle", true);
+	ASSERT_TRUE("Game::AnimationComponent::play()", l_animation->playing());
+
+	/* killed entities go back to the pool during the update */
+	l_entity->kill();
+	l_layer.update(0.f);
+	ASSERT_TRUE("Game::EntityPool::release() RECLAIMED",
+	    l_pool->available() == 2 && l_layer.getEntities().empty() &&
+	    !l_entity->isZombie());
+
+	const Math::Point2 &l_pos = l_position->position();
+	ASSERT_TRUE("Game::PositionComponent::reset()",
+	    l_pos.x == 0.f && l_pos.y == 0.f);
+	const Math::Vector2 &l_velocity = l_movement->velocity();
+	const Math::Vector2 &l_acceleration = l_movement->acceleration();
+	ASSERT_TRUE("Game::MovementComponent::reset()",
+	    l_velocity.x == 0.f && l_velocity.y == 0.f &&
+	    l_acceleration.x == 0.f && l_acceleration.y == 0.f);
+	ASSERT_FALSE("Game::AnimationComponent::reset()",
+	    l_animation->playing());
+
+	/* same entity comes back, nothing gets constructed */
+	Game::Entity *l_again = l_pool->acquire();
+	ASSERT_TRUE("Game::EntityPool::acquire() REUSED",
+	    l_again == l_entity && l_pool->size() == 2 &&
+	    ComponentOf<Game::PositionComponent>(l_again) == l_position);
+
+	/* empty pool constructs */
+	l_pool->acquire();
+	l_pool->acquire();
+	ASSERT_TRUE("Game::EntityPool::acquire() EMPTY",
+	    l_pool->size() == 3 && l_pool->available() == 0 &&
+	    l_layer.getEntities().size() == 3);
+}
+
+void
+entitypool_teardown_test(void)
+{
+	Game::Factory l_factory;
+
+	{
+		Game::EntitySceneLayer l_layer("layer", 0);
+		l_layer.addComponentPool(new WatchedPool);
+
+		Game::EntityPool *l_pool =
+		    new Game::EntityPool("bullet", &l_layer);
+		l_layer.addEntityPool(l_pool);
+		l_pool->addComponent(Game::PositionComponent::Type(),
+		    "position");
+		l_pool->reserve(3);
+
+		/* one live, one killed but not reclaimed, one dormant */
+		l_pool->acquire();
+		l_pool->acquire()->kill();
+
+		const Game::IComponentPool *l_positions =
+		    l_layer.componentPool(Game::PositionComponent::Type());
+		ASSERT_TRUE("Game::EntityPool POOLED COMPONENTS",
+		    l_positions && l_positions->size() == 3);
+	}
+
+	/* entities hand their components back before pools go away */
+	ASSERT_ZERO("Game::EntitySceneLayer::~EntitySceneLayer() ORDER",
+	    s_pool_left);
+}
+
+TESTS_BEGIN
+	TEST(entitypool_recycle_test)
+	TEST(entitypool_teardown_test)
+TESTS_END
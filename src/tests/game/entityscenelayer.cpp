@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#include "core/identifier.h"
+
+#include "game/entity.h"
+#include "game/entityscenelayer.h"
+
+#include "tests/common.h"
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+MARSHMALLOW_NAMESPACE_USE
+
+namespace {
+	int s_deleted(0);
+	int s_updated(0);
+	int s_zombies_rendered(0);
+
+	/* kills its victims on the nth update */
+	class Killer : public Game::Entity
+	{
+	public:
+		Killer(const Core::Identifier &i, Game::EntitySceneLayer *l)
+		    : Game::Entity(i, l)
+		    , countdown(0)
+		{ victims[0] = victims[1] = 0; }
+
+		virtual ~Killer(void)
+		    { ++s_deleted; }
+
+		VIRTUAL void
+		update(float d)
+		{
+			Game::Entity::update(d);
+			++s_updated;
+
+			if (countdown <= 0 || --countdown > 0)
+				return;
+
+			for (int i = 0; i < 2; ++i)
+				if (victims[i])
+					victims[i]->kill();
+		}
+
+		VIRTUAL void
+		render(void)
+		{
+			Game::Entity::render();
+
+			const Game::EntityList &l_entities =
+			    layer()->getEntities();
+			Game::EntityList::const_iterator l_i;
+			for (l_i = l_entities.begin();
+			     l_i != l_entities.end(); ++l_i)
+				if ((*l_i)->isZombie())
+					++s_zombies_rendered;
+		}
+
+		Game::IEntity *victims[2];
+		int countdown;
+	};
+
+	bool
+	Order(const Game::EntitySceneLayer &layer, Game::IEntity **expected,
+	      size_t count)
+	{
+		const Game::EntityList &l_entities = layer.getEntities();
+		if (l_entities.size() != count)
+			return(false);
+
+		Game::EntityList::const_iterator l_i = l_entities.begin();
+		for (size_t i = 0; i < count; ++i, ++l_i)
+			if (*l_i != expected[i])
+				return(false);
+		return(true);
+	}
+}
+
+void
+entityscenelayer_reclaim_test(void)
+{
+	Game::EntitySceneLayer l_layer("layer", 0);
+
+	Killer *l_a = new Killer("a", &l_layer);
+	Killer *l_b = new Killer("b", &l_layer);
+	Killer *l_c = new Killer("c", &l_layer);
+	Killer *l_d = new Killer("d", &l_layer);
+	Killer *l_e = new Killer("e", &l_layer);
+	Killer *l_f = new Killer("f", &l_layer);
+
+	l_layer.addEntity(l_a);
+	l_layer.addEntity(l_b);
+	l_layer.addEntity(l_c);
+	l_layer.addEntity(l_d);
+	l_layer.addEntity(l_e);
+	l_layer.addEntity(l_f);
+
+	/* b kills one entity already updated and one still pending */
+	l_b->victims[0] = l_a;
+	l_b->victims[1] = l_d;
+	l_b->countdown = 1;
+
+	/* second frame, c dies on the first step, b and f on the second */
+	l_c->victims[0] = l_c;
+	l_c->countdown = 2;
+	l_e->victims[0] = l_b;
+	l_e->victims[1] = l_f;
+	l_e->countdown = 3;
+
+	l_layer.update(1.f);
+
+	Game::IEntity *l_first[] = { l_b, l_c, l_e, l_f };
+	const bool l_first_order = Order(l_layer, l_first, 4);
+	ASSERT_TRUE("Game::EntitySceneLayer::update() SURVIVORS KEEP ORDER",
+	    l_first_order);
+	ASSERT_TRUE("Game::EntitySceneLayer::update() ZOMBIES DELETED",
+	    2 == s_deleted);
+
+	/* d died before its turn */
+	ASSERT_TRUE("Game::EntitySceneLayer::update() ZOMBIES SKIPPED",
+	    5 == s_updated);
+
+	l_layer.render();
+	ASSERT_TRUE("Game::EntitySceneLayer::reclaimed() FIRST FRAME",
+	    2 == l_layer.reclaimed());
+
+	/* two fixed steps within one frame */
+	l_layer.update(.5f);
+	Game::IEntity *l_step[] = { l_b, l_e, l_f };
+	const bool l_step_order = Order(l_layer, l_step, 3);
+	ASSERT_TRUE("Game::EntitySceneLayer::update() STEP ORDER",
+	    l_step_order);
+
+	l_layer.update(.5f);
+	Game::IEntity *l_second[] = { l_e };
+	const bool l_second_order = Order(l_layer, l_second, 1);
+	ASSERT_TRUE("Game::EntitySceneLayer::update() LAST SURVIVOR",
+	    l_second_order);
+
+	/* previous frame count holds until render closes the frame */
+	ASSERT_TRUE("Game::EntitySceneLayer::reclaimed() BEFORE RENDER",
+	    2 == l_layer.reclaimed());
+
+	l_layer.render();
+	ASSERT_TRUE("Game::EntitySceneLayer::reclaimed() SEVERAL STEPS",
+	    3 == l_layer.reclaimed());
+	ASSERT_TRUE("Game::EntitySceneLayer::render() NO ZOMBIES",
+	    0 == s_zombies_rendered);
+
+	/* quiet frame resets the count */
+	l_layer.update(1.f);
+	l_layer.render();
+	ASSERT_TRUE("Game::EntitySceneLayer::reclaimed() QUIET FRAME",
+	    0 == l_layer.reclaimed());
+	ASSERT_TRUE("Game::EntitySceneLayer::reclaimed() DELETED",
+	    5 == s_deleted);
+}
+
+TESTS_BEGIN
+	TEST(entityscenelayer_reclaim_test)
+TESTS_END
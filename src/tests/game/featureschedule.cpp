@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#include "game/featureschedule_p.h"
+
+#include "core/atomic.h"
+#include "core/jobs.h"
+#include "core/type.h"
+
+#include "game/ienginefeature.h"
+
+#include "tests/common.h"
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+MARSHMALLOW_NAMESPACE_USE
+
+namespace {
+
+	/* records the global tick order of every feature */
+	volatile int32_t s_ticks = 0;
+
+	struct TestFeature : public Game::IEngineFeature
+	{
+		TestFeature(const char *name, Affinity affinity = MainThread,
+		    const TestFeature *dependency = 0)
+		    : m_type(name)
+		    , m_affinity(affinity)
+		    , m_dependency(dependency)
+		    , order(-1)
+		    , ticks(0)
+		    , delta(0)
+		{}
+
+		const Core::Type & type(void) const
+		    { return(m_type); }
+		bool initialize(void)
+		    { return(true); }
+		void finalize(void)
+		    {}
+		void tick(float d)
+		{
+			order = Core::Atomic::Increment(&s_ticks) - 1;
+			++ticks;
+			delta = d;
+		}
+		Affinity affinity(void) const
+		    { return(m_affinity); }
+		bool dependsOn(const Core::Type &t) const
+		    { return(m_dependency && m_dependency->type() == t); }
+
+		Core::Type m_type;
+		Affinity m_affinity;
+		const TestFeature *m_dependency;
+		int32_t order;
+		int ticks;
+		float delta;
+	};
+
+	const Game::FeatureSchedule::Slot *
+	FindSlot(const Game::FeatureSchedule &schedule, const TestFeature &f)
+	{
+		for (size_t i = 0; i < schedule.size(); ++i)
+			if (schedule.slot(i).feature == &f)
+				return(&schedule.slot(i));
+		return(0);
+	}
+
+} // namespace
+
+void
+featureschedule_dependency_test(void)
+{
+	TestFeature l_input("input");
+	TestFeature l_physics("physics", TestFeature::MainThread, &l_input);
+	TestFeature l_audio("audio", TestFeature::MainThread, &l_physics);
+
+	/* registered backwards on purpose */
+	Game::EngineFeatureList l_features;
+	l_features.push_back(&l_audio);
+	l_features.push_back(&l_physics);
+	l_features.push_back(&l_input);
+
+	Game::FeatureSchedule l_schedule;
+	const bool l_built = l_schedule.build(l_features);
+	ASSERT_TRUE("Game::FeatureSchedule::build()", l_built);
+	ASSERT_EQUAL("Game::FeatureSchedule::size()", 3u, l_schedule.size());
+
+	const Game::FeatureSchedule::Slot *l_slot[3] = {
+	    FindSlot(l_schedule, l_input),
+	    FindSlot(l_schedule, l_physics),
+	    FindSlot(l_schedule, l_audio)
+	};
+	ASSERT_TRUE("Game::FeatureSchedule::build() LEVELS",
+	    l_slot[0] && l_slot[1] && l_slot[2] &&
+	    0 == l_slot[0]->level && 1 == l_slot[1]->level &&
+	    2 == l_slot[2]->level);
+
+	s_ticks = 0;
+	l_schedule.tick(.5f);
+	ASSERT_TRUE("Game::FeatureSchedule::tick() ORDER",
+	    0 == l_input.order && 1 == l_physics.order && 2 == l_audio.order);
+	ASSERT_TRUE("Game::FeatureSchedule::tick() DELTA",
+	    .5f == l_input.delta && .5f == l_audio.delta);
+	ASSERT_TRUE("Game::FeatureSchedule::slot() TICKS",
+	    1 == l_slot[0]->ticks && 1 == l_slot[2]->ticks);
+}
+
+void
+featureschedule_cycle_test(void)
+{
+	TestFeature l_a("a");
+	TestFeature l_b("b", TestFeature::MainThread, &l_a);
+	l_a.m_dependency = &l_b;
+
+	Game::EngineFeatureList l_features;
+	l_features.push_back(&l_a);
+	l_features.push_back(&l_b);
+
+	Game::FeatureSchedule l_schedule;
+	const bool l_built = l_schedule.build(l_features);
+	ASSERT_FALSE("Game::FeatureSchedule::build() CYCLE", l_built);
+
+	/* still ticks everything exactly once */
+	l_schedule.tick(1.f);
+	ASSERT_TRUE("Game::FeatureSchedule::tick() CYCLE",
+	    1 == l_a.ticks && 1 == l_b.ticks);
+}
+
+void
+featureschedule_affinity_test(void)
+{
+	TestFeature l_main("main");
+	TestFeature l_any1("any1", TestFeature::AnyThread);
+	TestFeature l_any2("any2", TestFeature::AnyThread);
+	TestFeature l_lone("lone", TestFeature::AnyThread, &l_any1);
+
+	Game::EngineFeatureList l_features;
+	l_features.push_back(&l_main);
+	l_features.push_back(&l_any1);
+	l_features.push_back(&l_any2);
+	l_features.push_back(&l_lone);
+
+	Game::FeatureSchedule l_schedule;
+	l_schedule.build(l_features);
+
+	/* main thread features never leave the calling thread */
+	const Game::FeatureSchedule::Slot *l_slot = FindSlot(l_schedule, l_main);
+	ASSERT_TRUE("Game::FeatureSchedule::build() MAIN THREAD",
+	    l_slot && !l_slot->worker);
+
+	/* any thread features sharing a level become workers */
+	l_slot = FindSlot(l_schedule, l_any1);
+	ASSERT_TRUE("Game::FeatureSchedule::build() ANY THREAD",
+	    l_slot && l_slot->worker);
+	l_slot = FindSlot(l_schedule, l_any2);
+	ASSERT_TRUE("Game::FeatureSchedule::build() ANY THREAD SHARED",
+	    l_slot && l_slot->worker);
+
+	/* alone on its level there is nothing to overlap with */
+	l_slot = FindSlot(l_schedule, l_lone);
+	ASSERT_TRUE("Game::FeatureSchedule::build() ANY THREAD ALONE",
+	    l_slot && 1 == l_slot->level && !l_slot->worker);
+
+	/* worker features get ticked as jobs, dependents after them */
+	Core::Jobs::Initialize(2);
+	s_ticks = 0;
+	l_schedule.tick(.25f);
+	l_schedule.tick(.25f);
+	Core::Jobs::Finalize();
+
+	ASSERT_TRUE("Game::FeatureSchedule::tick() JOBS",
+	    2 == l_main.ticks && 2 == l_any1.ticks &&
+	    2 == l_any2.ticks && 2 == l_lone.ticks);
+	ASSERT_TRUE("Game::FeatureSchedule::tick() JOBS ORDER",
+	    l_lone.order > l_any1.order && l_lone.order > l_any2.order);
+}
+
+TESTS_BEGIN
+	TEST(featureschedule_dependency_test)
+	TEST(featureschedule_cycle_test)
+	TEST(featureschedule_affinity_test)
+TESTS_END
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#include "game/framepacer.h"
+
+#include "core/platform.h"
+
+#include "tests/common.h"
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+MARSHMALLOW_NAMESPACE_USE
+
+static bool
+Near(MMTIME a, MMTIME b)
+{
+	return(a - b < 1e-9 && b - a < 1e-9);
+}
+
+void
+framepacer_disabled_test(void)
+{
+	Game::FramePacer l_pacer(-1, -1);
+	ASSERT_TRUE("Game::FramePacer::period() CLAMPED",
+	    Near(0, l_pacer.period()));
+	ASSERT_TRUE("Game::FramePacer::spin() CLAMPED",
+	    Near(0, l_pacer.spin()));
+
+	/* no period, no pacing */
+	l_pacer.wait();
+	ASSERT_TRUE("Game::FramePacer::wait() DISABLED",
+	    l_pacer.frames() == 0);
+}
+
+void
+framepacer_pacing_test(void)
+{
+	const MMTIME l_period = .01;
+	const uint32_t l_count = 10;
+
+	Game::FramePacer l_pacer(l_period);
+	const MMTIME l_start = NOW();
+	l_pacer.reset();
+
+	for (uint32_t i = 0; i < l_count; ++i)
+		l_pacer.wait();
+
+	/* deadlines advance a full period each frame, whatever happens */
+	const MMTIME l_elapsed = NOW() - l_start;
+	ASSERT_TRUE("Game::FramePacer::wait() PACED",
+	    l_elapsed >= l_count * l_period);
+	ASSERT_TRUE("Game::FramePacer::frames()",
+	    l_pacer.frames() == l_count);
+	ASSERT_TRUE("Game::FramePacer::error()",
+	    l_pacer.error() >= 0 && l_pacer.errorMax() >= l_pacer.error());
+
+	l_pacer.resetStats();
+	ASSERT_TRUE("Game::FramePacer::resetStats()",
+	    l_pacer.frames() == 0 && l_pacer.missed() == 0 &&
+	    Near(0, l_pacer.slept()) && Near(0, l_pacer.spun()));
+}
+
+void
+framepacer_spin_test(void)
+{
+	const MMTIME l_period = .005;
+
+	/* spin tail covering the whole period never sleeps */
+	Game::FramePacer l_spinner(l_period, l_period * 2);
+	l_spinner.reset();
+	l_spinner.wait();
+	l_spinner.wait();
+	ASSERT_TRUE("Game::FramePacer::slept() SPIN ONLY",
+	    Near(0, l_spinner.slept()));
+	ASSERT_TRUE("Game::FramePacer::spun() SPIN ONLY",
+	    l_spinner.spun() > 0);
+
+	/* without a spin tail most of the wait is slept */
+	Game::FramePacer l_sleeper(l_period, 0);
+	l_sleeper.reset();
+	l_sleeper.wait();
+	l_sleeper.wait();
+	ASSERT_TRUE("Game::FramePacer::slept() NO SPIN",
+	    l_sleeper.slept() > 0);
+
+	l_sleeper.setSpin(.001);
+	ASSERT_TRUE("Game::FramePacer::setSpin()",
+	    Near(.001, l_sleeper.spin()));
+}
+
+void
+framepacer_missed_test(void)
+{
+	const MMTIME l_period = .02;
+
+	Game::FramePacer l_pacer(l_period);
+	l_pacer.reset();
+
+	/* fall over a frame behind */
+	Core::Platform::Sleep(l_period * 3);
+	l_pacer.wait();
+	ASSERT_TRUE("Game::FramePacer::missed()",
+	    l_pacer.frames() == 1 && l_pacer.missed() == 1);
+
+	/* deadline re-anchored, next frame waits a full period */
+	const MMTIME l_start = NOW();
+	l_pacer.wait();
+	const MMTIME l_elapsed = NOW() - l_start;
+	ASSERT_TRUE("Game::FramePacer::wait() RE-ANCHORED",
+	    l_elapsed > l_period / 2);
+	ASSERT_TRUE("Game::FramePacer::missed() RECOVERED",
+	    l_pacer.frames() == 2 && l_pacer.missed() == 1);
+}
+
+TESTS_BEGIN
+	TEST(framepacer_disabled_test)
+	TEST(framepacer_pacing_test)
+	TEST(framepacer_spin_test)
+	TEST(framepacer_missed_test)
+TESTS_END
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#include "game/framestats.h"
+
+#include "tests/common.h"
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+MARSHMALLOW_NAMESPACE_USE
+
+static bool
+Near(MMTIME a, MMTIME b)
+{
+	return(a - b < 1e-9 && b - a < 1e-9);
+}
+
+void
+framestats_ring_test(void)
+{
+	Game::FrameStats l_stats(4);
+
+	ASSERT_EQUAL("Game::FrameStats::capacity()",
+	    4, static_cast<int>(l_stats.capacity()));
+	ASSERT_ZERO("Game::FrameStats::frames() EMPTY",
+	    static_cast<int>(l_stats.frames()));
+	ASSERT_TRUE("Game::FrameStats::average() EMPTY",
+	    Near(0, l_stats.average(Game::FrameStats::Frame)));
+
+	/* phase time accumulates until commit */
+	l_stats.record(Game::FrameStats::Update, .25);
+	l_stats.record(Game::FrameStats::Update, .5);
+	l_stats.commit();
+	ASSERT_TRUE("Game::FrameStats::record() ACCUMULATES",
+	    Near(.75, l_stats.last(Game::FrameStats::Update)));
+	ASSERT_TRUE("Game::FrameStats::commit() CLEARS CURRENT",
+	    Near(0, l_stats.last(Game::FrameStats::Render)));
+
+	/* older frames get overwritten once the ring wraps */
+	l_stats.reset();
+	for (int i = 1; i <= 6; ++i) {
+		l_stats.record(Game::FrameStats::Frame, i);
+		l_stats.commit();
+	}
+
+	ASSERT_EQUAL("Game::FrameStats::frames() WRAPPED",
+	    4, static_cast<int>(l_stats.frames()));
+	ASSERT_EQUAL("Game::FrameStats::total() WRAPPED",
+	    6, static_cast<int>(l_stats.total()));
+	ASSERT_TRUE("Game::FrameStats::last() WRAPPED",
+	    Near(6, l_stats.last(Game::FrameStats::Frame)));
+	ASSERT_TRUE("Game::FrameStats::worst() WRAPPED",
+	    Near(6, l_stats.worst(Game::FrameStats::Frame)));
+	ASSERT_TRUE("Game::FrameStats::average() WRAPPED",
+	    Near(4.5, l_stats.average(Game::FrameStats::Frame)));
+	ASSERT_TRUE("Game::FrameStats::percentile() WRAPPED MINIMUM",
+	    Near(3, l_stats.percentile(Game::FrameStats::Frame, 0)));
+
+	l_stats.setCapacity(8);
+	ASSERT_EQUAL("Game::FrameStats::setCapacity()",
+	    8, static_cast<int>(l_stats.capacity()));
+	ASSERT_ZERO("Game::FrameStats::setCapacity() FORGETS FRAMES",
+	    static_cast<int>(l_stats.frames() + l_stats.total()));
+}
+
+void
+framestats_average_test(void)
+{
+	Game::FrameStats l_stats(16);
+
+	/* partially filled ring only averages frames held */
+	for (int i = 0; i < 3; ++i) {
+		l_stats.record(Game::FrameStats::Render, .010 * (i + 1));
+		l_stats.commit();
+	}
+
+	ASSERT_TRUE("Game::FrameStats::average() PARTIAL",
+	    Near(.020, l_stats.average(Game::FrameStats::Render)));
+	ASSERT_TRUE("Game::FrameStats::average() UNRECORDED PHASE",
+	    Near(0, l_stats.average(Game::FrameStats::Update)));
+}
+
+void
+framestats_percentile_test(void)
+{
+	Game::FrameStats l_stats(100);
+
+	/* 1..100 in scrambled order */
+	for (int i = 0; i < 100; ++i) {
+		l_stats.record(Game::FrameStats::Frame, (i * 37) % 100 + 1);
+		l_stats.commit();
+	}
+
+	ASSERT_TRUE("Game::FrameStats::percentile() MEDIAN",
+	    Near(50, l_stats.percentile(Game::FrameStats::Frame, 50.f)));
+	ASSERT_TRUE("Game::FrameStats::percentile() 99TH",
+	    Near(99, l_stats.percentile(Game::FrameStats::Frame, 99.f)));
+	ASSERT_TRUE("Game::FrameStats::percentile() NEAREST RANK",
+	    Near(91, l_stats.percentile(Game::FrameStats::Frame, 90.5f)));
+	ASSERT_TRUE("Game::FrameStats::percentile() MAXIMUM",
+	    Near(100, l_stats.percentile(Game::FrameStats::Frame, 100.f)));
+	ASSERT_TRUE("Game::FrameStats::percentile() CLAMPED",
+	    Near(100, l_stats.percentile(Game::FrameStats::Frame, 150.f)) &&
+	    Near(1, l_stats.percentile(Game::FrameStats::Frame, -5.f)));
+	ASSERT_TRUE("Game::FrameStats::worst()",
+	    Near(100, l_stats.worst(Game::FrameStats::Frame)));
+}
+
+TESTS_BEGIN
+	TEST(framestats_ring_test)
+	TEST(framestats_average_test)
+	TEST(framestats_percentile_test)
+TESTS_END
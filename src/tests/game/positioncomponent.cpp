@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#include "game/positioncomponent.h"
+
+#include "core/identifier.h"
+
+#include "game/backend_p.h"
+#include "game/framestats.h"
+#include "game/iengine.h"
+
+#include "tests/common.h"
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+MARSHMALLOW_NAMESPACE_USE
+
+namespace {
+
+	/* engine stand-in with a hand driven simulation clock */
+	struct StepEngine : public Game::IEngine
+	{
+		StepEngine(void)
+		    : step_count(0)
+		    , alpha(1.f)
+		{ Game::Backend::SetInstance(this); }
+
+		~StepEngine(void)
+		{ Game::Backend::SetInstance(0); }
+
+		int run(void) { return(0); }
+		void stop(int) {}
+		void suspend(void) {}
+		void resume(void) {}
+		bool isSuspended(void) const { return(false); }
+
+		float fixedStep(void) const { return(.01f); }
+		uint32_t stepCount(void) const { return(step_count); }
+		float interpolation(void) const { return(alpha); }
+		const Game::FrameStats & frameStats(void) const { return(stats); }
+
+		Event::EventManager * eventManager(void) const { return(0); }
+		Game::SceneManager * sceneManager(void) const { return(0); }
+		Game::IFactory * factory(void) const { return(0); }
+
+		void addFeature(Game::IEngineFeature *) {}
+		void removeFeature(Game::IEngineFeature *) {}
+		Game::IEngineFeature * removeFeature(const Core::Type &)
+		    { return(0); }
+		Game::IEngineFeature * getFeature(const Core::Type &)
+		    { return(0); }
+
+		Game::FrameStats stats;
+		uint32_t step_count;
+		float alpha;
+	};
+
+	bool
+	Near(const Math::Point2 &a, float x, float y)
+	{
+		return(a.x - x < 1e-4f && x - a.x < 1e-4f &&
+		       a.y - y < 1e-4f && y - a.y < 1e-4f);
+	}
+
+} // namespace
+
+void
+positioncomponent_interpolated_test(void)
+{
+	StepEngine l_engine;
+	Game::PositionComponent l_position("position", 0);
+
+	/* initial placement is never blended */
+	l_engine.step_count = 1;
+	l_engine.alpha = .5f;
+	l_position.setPosition(10, 0);
+	Math::Point2 l_blend = l_position.interpolated();
+	ASSERT_TRUE("Game::PositionComponent::interpolated() PLACED",
+	    Near(l_blend, 10, 0));
+
+	/* moved this step, blend from the previous step position */
+	l_engine.step_count = 2;
+	l_position.setPosition(20, 10);
+	l_position.setPosition(30, 20);
+	l_blend = l_position.interpolated();
+	ASSERT_TRUE("Game::PositionComponent::interpolated() BLENDED",
+	    Near(l_blend, 20, 10));
+
+	l_engine.alpha = 0.f;
+	l_blend = l_position.interpolated();
+	ASSERT_TRUE("Game::PositionComponent::interpolated() ALPHA ZERO",
+	    Near(l_blend, 10, 0));
+
+	l_engine.alpha = 1.f;
+	l_blend = l_position.interpolated();
+	ASSERT_TRUE("Game::PositionComponent::interpolated() ALPHA ONE",
+	    Near(l_blend, 30, 20));
+
+	/* resting for a step, nothing to blend */
+	l_engine.step_count = 3;
+	l_engine.alpha = .5f;
+	l_blend = l_position.interpolated();
+	ASSERT_TRUE("Game::PositionComponent::interpolated() RESTING",
+	    Near(l_blend, 30, 20));
+}
+
+void
+positioncomponent_teleport_test(void)
+{
+	StepEngine l_engine;
+	Game::PositionComponent l_position("position", 0);
+
+	l_engine.step_count = 1;
+	l_position.setPosition(0, 0);
+
+	/* teleports land in place, no streak across the screen */
+	l_engine.step_count = 2;
+	l_engine.alpha = .5f;
+	l_position.teleport(100, 50);
+	Math::Point2 l_blend = l_position.interpolated();
+	ASSERT_TRUE("Game::PositionComponent::teleport()",
+	    Near(l_blend, 100, 50));
+	ASSERT_TRUE("Game::PositionComponent::position() TELEPORTED",
+	    Near(l_position.position(), 100, 50));
+
+	/* regular moves blend from the teleport target */
+	l_engine.step_count = 3;
+	l_position.setPosition(110, 50);
+	l_blend = l_position.interpolated();
+	ASSERT_TRUE("Game::PositionComponent::interpolated() AFTER TELEPORT",
+	    Near(l_blend, 105, 50));
+}
+
+TESTS_BEGIN
+	TEST(positioncomponent_interpolated_test)
+	TEST(positioncomponent_teleport_test)
+TESTS_END
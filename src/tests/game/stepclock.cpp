@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#include "game/stepclock.h"
+
+#include "tests/common.h"
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+MARSHMALLOW_NAMESPACE_USE
+
+static bool
+Near(float a, float b)
+{
+	return(a - b < 1e-4f && b - a < 1e-4f);
+}
+
+void
+stepclock_variable_test(void)
+{
+	Game::StepClock l_clock;
+
+	/* no fixed step, one full step per frame whatever the delta */
+	const int l_long = l_clock.advance(.5f);
+	const int l_short = l_clock.advance(.001f);
+	ASSERT_TRUE("Game::StepClock::advance() VARIABLE",
+	    1 == l_long && 1 == l_short);
+	ASSERT_TRUE("Game::StepClock::alpha() VARIABLE",
+	    Near(1.f, l_clock.alpha()));
+
+	l_clock.setStep(-1);
+	ASSERT_TRUE("Game::StepClock::setStep() CLAMPED",
+	    Near(0, l_clock.step()));
+}
+
+void
+stepclock_fixed_test(void)
+{
+	Game::StepClock l_clock(.01f);
+
+	/* less than a step, nothing to run yet */
+	int l_steps = l_clock.advance(.004f);
+	ASSERT_ZERO("Game::StepClock::advance() PARTIAL", l_steps);
+	ASSERT_TRUE("Game::StepClock::alpha() PARTIAL",
+	    Near(.4f, l_clock.alpha()));
+
+	/* remainder carries over into the next frame */
+	l_steps = l_clock.advance(.008f);
+	ASSERT_EQUAL("Game::StepClock::advance() CARRY", 1, l_steps);
+	ASSERT_TRUE("Game::StepClock::alpha() CARRY",
+	    Near(.2f, l_clock.alpha()));
+
+	l_steps = l_clock.advance(.03f);
+	ASSERT_EQUAL("Game::StepClock::advance() MULTIPLE", 3, l_steps);
+	ASSERT_TRUE("Game::StepClock::alpha() MULTIPLE",
+	    Near(.2f, l_clock.alpha()));
+
+	l_clock.reset();
+	ASSERT_TRUE("Game::StepClock::reset()",
+	    Near(0, l_clock.alpha()));
+
+	/* changing the step drops accumulated time */
+	l_clock.advance(.005f);
+	l_clock.setStep(.02f);
+	ASSERT_TRUE("Game::StepClock::setStep() RESET",
+	    Near(.02f, l_clock.step()) && Near(0, l_clock.alpha()));
+	ASSERT_ZERO("Game::StepClock::dropped()", l_clock.dropped());
+}
+
+void
+stepclock_cap_test(void)
+{
+	Game::StepClock l_clock(.01f, 4);
+	ASSERT_EQUAL("Game::StepClock::maxSteps()", 4, l_clock.maxSteps());
+
+	/* ten steps behind, run the cap and drop the rest */
+	int l_steps = l_clock.advance(.105f);
+	ASSERT_EQUAL("Game::StepClock::advance() CAPPED", 4, l_steps);
+	ASSERT_EQUAL("Game::StepClock::dropped() CAPPED",
+	    6u, l_clock.dropped());
+	ASSERT_TRUE("Game::StepClock::alpha() CAPPED",
+	    Near(.5f, l_clock.alpha()));
+
+	/* back to normal once caught up */
+	l_steps = l_clock.advance(.005f);
+	ASSERT_EQUAL("Game::StepClock::advance() RECOVERED", 1, l_steps);
+	ASSERT_EQUAL("Game::StepClock::dropped() RECOVERED",
+	    6u, l_clock.dropped());
+}
+
+TESTS_BEGIN
+	TEST(stepclock_variable_test)
+	TEST(stepclock_fixed_test)
+	TEST(stepclock_cap_test)
+TESTS_END
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2014, Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ * All rights reserved.
+ *
+ * This file is part of Marshmallow Game Engine.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE CONTRIBUTORS ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are
+ * those of the authors and should not be interpreted as representing official
+ * policies, either expressed or implied, of the project as a whole.
+ */
+
+#include "core/identifier.h"
+#include "core/type.h"
+
+#include "math/matrix4.h"
+#include "math/point2.h"
+#include "math/vector2.h"
+
+#include "graphics/color.h"
+#include "graphics/drawlist_p.h"
+#include "graphics/painter.h"
+#include "graphics/quadmesh.h"
+
+#include "tests/common.h"
+
+/*!
+ * @file
+ *
+ * @author Guillermo A. Amaral B. (gamaral) <g@maral.me>
+ */
+
+MARSHMALLOW_NAMESPACE_USE
+
+namespace {
+
+bool
+Near(float a, float b)
+{
+	return(a - b < 1e-5f && b - a < 1e-5f);
+}
+
+} // namespace
+
+void
+drawlist_record_test(void)
+{
+	Graphics::QuadMesh l_mesh(16.f, 16.f);
+	l_mesh.setColor(Graphics::Color(1.f, .5f, .25f));
+	l_mesh.setRotation(90.f);
+
+	const Math::Point2 l_origins[3] =
+	    { Math::Point2(1, 2), Math::Point2(3, 4), Math::Point2(5, 6) };
+
+	Graphics::DrawList l_list;
+	l_list.clear();
+
+	Graphics::DrawList::SetRecording(&l_list);
+	ASSERT_TRUE("Graphics::DrawList::Recording()",
+	    Graphics::DrawList::Recording() == &l_list);
+
+	Graphics::Painter::PushMatrix();
+	Graphics::Painter::LoadIdentity();
+	Graphics::Painter::Matrix()[Math::Matrix4::m14] = 8.f;
+	Graphics::Painter::Draw(l_mesh, l_origins, 3);
+	Graphics::Painter::PopMatrix();
+
+	/* mesh state is captured at draw time */
+	l_mesh.setRotation(45.f);
+	Graphics::Painter::Draw(l_mesh, l_origins[2]);
+
+	Graphics::DrawList::SetRecording(0);
+	Graphics::Painter::Draw(l_mesh, l_origins[0]);
+
+	ASSERT_TRUE("Graphics::DrawList::size()", l_list.size() == 2);
+
+	const Graphics::DrawList::Command &l_first = l_list.command(0);
+	const Graphics::DrawList::Command &l_second = l_list.command(1);
+
+	ASSERT_TRUE("Graphics::DrawList::draw() TYPE",
+	    *l_first.type == Graphics::QuadMesh::Type());
+	ASSERT_TRUE("Graphics::DrawList::draw() COLOR",
+	    Near(l_first.color.green(), .5f));
+	ASSERT_TRUE("Graphics::DrawList::draw() ROTATION",
+	    Near(l_first.rotation, 90.f) && Near(l_second.rotation, 45.f));
+	ASSERT_TRUE("Graphics::DrawList::draw() ORIGIN COUNT",
+	    l_first.count == 3 && l_second.count == 1);
+	ASSERT_TRUE("Graphics::DrawList::origins()",
+	    Near(l_list.origins(l_first)[1].y, 4.f) &&
+	    Near(l_list.origins(l_second)[0].x, 5.f));
+	ASSERT_TRUE("Graphics::DrawList::matrix() CAPTURED",
+	    Near(l_first.matrix[Math::Matrix4::m14], 8.f));
+	ASSERT_TRUE("Graphics::DrawList::popMatrix() RESTORED",
+	    !Near(l_second.matrix[Math::Matrix4::m14], 8.f));
+
+	Graphics::DrawListMesh l_replay(l_list, l_first);
+	ASSERT_TRUE("Graphics::DrawListMesh REPLAY",
+	    l_replay.type() == Graphics::QuadMesh::Type() &&
+	    l_replay.count() == l_mesh.count() &&
+	    l_replay.vertexData() == 0);
+
+	l_list.clear();
+	ASSERT_TRUE("Graphics::DrawList::clear()", l_list.size() == 0);
+}
+
+void
+drawlist_copy_test(void)
+{
+	const Math::Point2 l_origin(1, 2);
+
+	Graphics::DrawList l_list;
+	l_list.clear();
+
+	Graphics::QuadMesh *l_mesh = new Graphics::QuadMesh(16.f, 8.f);
+	const Math::Vector2 l_vertex = l_mesh->vertex(3);
+	float l_u, l_v;
+	l_mesh->textureCoordinate(3, l_u, l_v);
+
+	Graphics::DrawList::SetRecording(&l_list);
+	Graphics::Painter::Draw(*l_mesh, l_origin);
+	Graphics::DrawList::SetRecording(0);
+
+	/* mesh data may change or go away before submission */
+	l_mesh->setVertex(3, Math::Vector2(100.f, 100.f));
+	delete l_mesh, l_mesh = 0;
+
+	ASSERT_TRUE("Graphics::DrawList::size()", l_list.size() == 1);
+
+	const Graphics::DrawList::Command &l_command = l_list.command(0);
+	const float *l_vertexes = l_list.vertexes(l_command);
+	ASSERT_TRUE("Graphics::DrawList::vertexes() COPIED",
+	    Near(l_vertexes[6], l_vertex.x) && Near(l_vertexes[7], l_vertex.y));
+
+	const float *l_coords = l_list.textureCoordinates(l_command);
+	ASSERT_TRUE("Graphics::DrawList::textureCoordinates() COPIED",
+	    l_coords && Near(l_coords[6], l_u) && Near(l_coords[7], l_v));
+
+	Graphics::DrawListMesh l_replay(l_list, l_command);
+	const Math::Vector2 l_replay_vertex = l_replay.vertex(3);
+	ASSERT_TRUE("Graphics::DrawListMesh::vertex()",
+	    Near(l_replay_vertex.x, l_vertex.x) &&
+	    Near(l_replay_vertex.y, l_vertex.y));
+}
+
+TESTS_BEGIN
+	TEST(drawlist_record_test)
+	TEST(drawlist_copy_test)
+TESTS_END